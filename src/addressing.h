@@ -0,0 +1,249 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_ADDRESSING_H
+#define TIC28X_ADDRESSING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "architecture.h"
+#include "instructions.h"
+#include "registers.h"
+
+namespace TIC28X {
+/**
+ * Location Kinds
+ * The addressing mode an 8-bit loc16/loc32 code selects. XARn, ARPn and
+ * register forms carry their register in LocMode::reg.
+ */
+enum LocKind : uint8_t {
+  LOC_INVALID,
+  LOC_DP_DIRECT,         // @6bit (AMODE0)
+  LOC_DP_DIRECT_7BIT,    // @@7bit (AMODE1)
+  LOC_SP_OFFSET,         // *-SP[6bit]
+  LOC_SP_POSTINC,        // *SP++
+  LOC_SP_PREDEC,         // *--SP
+  LOC_XARN_POSTINC,      // *XARn++
+  LOC_XARN_PREDEC,       // *--XARn
+  LOC_XARN_INDEXED,      // *+XARn[AR0], *+XARn[AR1]
+  LOC_XARN_OFFSET,       // *+XARn[3bit]
+  LOC_ARP,               // *
+  LOC_ARP_POSTINC,       // *++
+  LOC_ARP_POSTDEC,       // *--
+  LOC_ARP_AR0_POSTINC,   // *0++
+  LOC_ARP_AR0_POSTDEC,   // *0--
+  LOC_ARP_BR0_POSTINC,   // *BR0++
+  LOC_ARP_BR0_POSTDEC,   // *BR0--
+  LOC_CIRCULAR,          // *AR6%++ (AMODE0)
+  LOC_CIRCULAR_INDEXED,  // *+XAR6[AR1%++] (AMODE1)
+  LOC_REGISTER,          // @reg
+};
+
+// Number of LocKind values
+constexpr size_t LOC_KIND_COUNT = LOC_REGISTER + 1;
+
+/**
+ * LocMode - everything an 8-bit location code says about an operand, so that
+ * Text and Lift never have to pick the code apart themselves.
+ */
+struct LocMode {
+  LocKind kind;
+  uint8_t reg;       // base register, or the register of LOC_REGISTER
+  uint8_t index;     // index register of the indexed and circular forms
+  uint8_t imm;       // immediate offset of the DP, SP and 3-bit forms
+  uint8_t imm_bits;  // width of imm
+  uint8_t arp;       // ARP selected after the access, or NO_ARP
+
+  static constexpr uint8_t NO_ARP = 0xFF;
+};
+
+namespace Addressing {
+/**
+ * ClassifyLoc - decodes a location code the slow way. Only used to build
+ * LOC_MODES.
+ *
+ * @param loc - 8-bit location code
+ * @param amode - current addressing mode
+ * @param is_loc32 - loc32 (true) or loc16 (false) operand
+ * @return addressing mode descriptor
+ */
+constexpr LocMode ClassifyLoc(const uint8_t loc, const AddressMode amode,
+                              const bool is_loc32) {
+  using namespace Registers;
+  const uint8_t n = loc & 0x7;
+  const uint8_t xarn = XAR0 + n;
+  LocMode mode = {.kind = LOC_INVALID, .arp = LocMode::NO_ARP};
+
+  /* Direct Addressing Modes (DP) */
+  // AMODE0, code == 0 0 III III, @6bit; AMODE1, code == 0 I III III, @@7bit
+  if ((loc & 0xC0) == 0) {
+    mode.kind = amode == AMODE_0 ? LOC_DP_DIRECT : LOC_DP_DIRECT_7BIT;
+    mode.imm = loc & 0x3F;
+    mode.imm_bits = 6;
+    return mode;
+  }
+
+  /* Stack Addressing Modes (SP) */
+  // AMODE0, code == 0 1 III III, *-SP[6bit]
+  if ((loc & 0xC0) == 0x40) {
+    if (amode == AMODE_0) {
+      mode.kind = LOC_SP_OFFSET;
+      mode.reg = SP;
+      mode.imm = loc & 0x3F;
+      mode.imm_bits = 6;
+    }
+    return mode;
+  }
+
+  /* Indirect Addressing Modes, code == 1 1 ... */
+  if ((loc & 0xC0) == 0xC0) {
+    if (amode == AMODE_0) {  // *+XARn[3bit]
+      mode.kind = LOC_XARN_OFFSET;
+      mode.reg = xarn;
+      mode.imm = (loc & 0x38) >> 3;
+      mode.imm_bits = 3;
+      return mode;
+    }
+
+    // AMODE1, C2xLP forms that also select ARPn
+    constexpr std::array<LocKind, 8> ARP_KINDS = {
+        LOC_ARP_POSTINC,     LOC_ARP_POSTDEC,     LOC_ARP_AR0_POSTINC,
+        LOC_ARP_AR0_POSTDEC, LOC_ARP_BR0_POSTINC, LOC_ARP_BR0_POSTDEC,
+        LOC_INVALID,         LOC_INVALID,
+    };
+    constexpr std::array<uint8_t, 8> ARP_REGS = {0, 0, AR0, AR0, BR0, BR0};
+    mode.kind = ARP_KINDS[(loc & 0x38) >> 3];
+    if (mode.kind != LOC_INVALID) {
+      mode.reg = ARP_REGS[(loc & 0x38) >> 3];
+      mode.arp = n;
+    }
+    return mode;
+  }
+
+  /* code == 1 0 ... */
+  switch (loc & 0xF8) {
+    case 0x80:  // *XARn++
+      mode.kind = LOC_XARN_POSTINC;
+      mode.reg = xarn;
+      return mode;
+    case 0x88:  // *--XARn
+      mode.kind = LOC_XARN_PREDEC;
+      mode.reg = xarn;
+      return mode;
+    case 0x90:  // *+XARn[AR0]
+    case 0x98:  // *+XARn[AR1]
+      mode.kind = LOC_XARN_INDEXED;
+      mode.reg = xarn;
+      mode.index = (loc & 0xF8) == 0x90 ? AR0 : AR1;
+      return mode;
+    case 0xA0:  // @ARn (loc16), @XARn (loc32)
+      mode.kind = LOC_REGISTER;
+      mode.reg = is_loc32 ? xarn : static_cast<uint8_t>(AR0 + n);
+      return mode;
+    case 0xB0:  // *,ARPn
+      mode.kind = LOC_ARP;
+      mode.arp = n;
+      return mode;
+    default:
+      break;
+  }
+
+  // code == 1 0 101 RRR, register forms; 110 and 111 use the current ARP
+  constexpr std::array<uint8_t, 6> REGS16 = {AH, AL, PH, PL, TH, SP};
+  constexpr uint8_t NONE = 0xFF;
+  constexpr std::array<uint8_t, 6> REGS32 = {NONE, ACC, NONE, P, XT, NONE};
+  switch (loc) {
+    case 0xA8:
+    case 0xA9:
+    case 0xAA:
+    case 0xAB:
+    case 0xAC:
+    case 0xAD:
+      mode.reg = (is_loc32 ? REGS32 : REGS16)[loc - 0xA8];
+      if (mode.reg != NONE) {
+        mode.kind = LOC_REGISTER;
+      }
+      return mode;
+    case 0xAE:
+      mode.kind = LOC_ARP_BR0_POSTINC;
+      mode.reg = BR0;
+      return mode;
+    case 0xAF:
+      mode.kind = LOC_ARP_BR0_POSTDEC;
+      mode.reg = BR0;
+      return mode;
+    case 0xB8:
+      mode.kind = LOC_ARP;
+      return mode;
+    case 0xB9:
+      mode.kind = LOC_ARP_POSTINC;
+      return mode;
+    case 0xBA:
+      mode.kind = LOC_ARP_POSTDEC;
+      return mode;
+    case 0xBB:
+      mode.kind = LOC_ARP_AR0_POSTINC;
+      mode.reg = AR0;
+      return mode;
+    case 0xBC:
+      mode.kind = LOC_ARP_AR0_POSTDEC;
+      mode.reg = AR0;
+      return mode;
+    case 0xBD:
+      mode.kind = LOC_SP_POSTINC;
+      mode.reg = SP;
+      return mode;
+    case 0xBE:
+      mode.kind = LOC_SP_PREDEC;
+      mode.reg = SP;
+      return mode;
+    case 0xBF:  // *AR6%++ (AMODE0), *+XAR6[AR1%++] (AMODE1)
+      mode.kind = amode == AMODE_0 ? LOC_CIRCULAR : LOC_CIRCULAR_INDEXED;
+      mode.reg = AR6;
+      mode.index = AR1;  // AR1 also holds the buffer size
+      return mode;
+    default:
+      return mode;
+  }
+}
+
+constexpr size_t Index(const uint8_t loc, const AddressMode amode,
+                       const bool is_loc32) {
+  return size_t{is_loc32} << 9 | size_t{amode == AMODE_1} << 8 | loc;
+}
+}  // namespace Addressing
+
+/**
+ * LOC_MODES - every location code, for both addressing modes and both
+ * operand widths, classified at compile time. Index with GetLocMode.
+ */
+inline constexpr std::array<LocMode, 0x400> LOC_MODES = [] {
+  std::array<LocMode, 0x400> modes = {};
+  for (const bool is_loc32 : {false, true}) {
+    for (const auto amode : {AMODE_0, AMODE_1}) {
+      for (size_t loc = 0; loc <= 0xFF; loc++) {
+        modes[Addressing::Index(loc, amode, is_loc32)] =
+            Addressing::ClassifyLoc(loc, amode, is_loc32);
+      }
+    }
+  }
+  return modes;
+}();
+
+/**
+ * GetLocMode - looks up the addressing mode of a loc16/loc32 operand.
+ *
+ * @param loc - 8-bit location code
+ * @param amode - current addressing mode
+ * @param kind - OPERAND_LOC16 or OPERAND_LOC32 (see Field::kind)
+ * @return addressing mode descriptor
+ */
+constexpr const LocMode& GetLocMode(const uint8_t loc, const AddressMode amode,
+                                    const OperandKind kind) {
+  return LOC_MODES[Addressing::Index(loc, amode, kind == OPERAND_LOC32)];
+}
+}  // namespace TIC28X
+
+#endif  // TIC28X_ADDRESSING_H
@@ -0,0 +1,125 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "addressing.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "text.h"
+
+using TIC28X::GetLocMode;
+
+// Spot check one code of each addressing mode family
+TEST(TestAddressing, Classify) {
+  namespace Registers = TIC28X::Registers;
+  const auto loc16 = TIC28X::OPERAND_LOC16;
+  const auto loc32 = TIC28X::OPERAND_LOC32;
+
+  // @6bit vs. @@7bit
+  EXPECT_EQ(GetLocMode(0x25, TIC28X::AMODE_0, loc16).kind,
+            TIC28X::LOC_DP_DIRECT);
+  EXPECT_EQ(GetLocMode(0x25, TIC28X::AMODE_0, loc16).imm, 0x25);
+  EXPECT_EQ(GetLocMode(0x25, TIC28X::AMODE_1, loc16).kind,
+            TIC28X::LOC_DP_DIRECT_7BIT);
+
+  // *-SP[6bit] only exists in AMODE0
+  EXPECT_EQ(GetLocMode(0x43, TIC28X::AMODE_0, loc32).kind,
+            TIC28X::LOC_SP_OFFSET);
+  EXPECT_EQ(GetLocMode(0x43, TIC28X::AMODE_0, loc32).imm, 0x3);
+  EXPECT_EQ(GetLocMode(0x43, TIC28X::AMODE_1, loc32).kind,
+            TIC28X::LOC_INVALID);
+
+  // *+XAR5[AR1]
+  const auto& indexed = GetLocMode(0x9D, TIC28X::AMODE_0, loc16);
+  EXPECT_EQ(indexed.kind, TIC28X::LOC_XARN_INDEXED);
+  EXPECT_EQ(indexed.reg, Registers::XAR5);
+  EXPECT_EQ(indexed.index, Registers::AR1);
+
+  // *+XAR2[5] (AMODE0) vs. *0++,ARP2 (AMODE1)
+  const auto& offset = GetLocMode(0xEA, TIC28X::AMODE_0, loc16);
+  EXPECT_EQ(offset.kind, TIC28X::LOC_XARN_OFFSET);
+  EXPECT_EQ(offset.reg, Registers::XAR2);
+  EXPECT_EQ(offset.imm, 5);
+  const auto& arp = GetLocMode(0xD2, TIC28X::AMODE_1, loc16);
+  EXPECT_EQ(arp.kind, TIC28X::LOC_ARP_AR0_POSTINC);
+  EXPECT_EQ(arp.arp, 2);
+
+  // Register forms depend on the operand width
+  EXPECT_EQ(GetLocMode(0xA3, TIC28X::AMODE_0, loc16).reg, Registers::AR3);
+  EXPECT_EQ(GetLocMode(0xA3, TIC28X::AMODE_0, loc32).reg, Registers::XAR3);
+  EXPECT_EQ(GetLocMode(0xA9, TIC28X::AMODE_0, loc16).reg, Registers::AL);
+  EXPECT_EQ(GetLocMode(0xA9, TIC28X::AMODE_0, loc32).reg, Registers::ACC);
+  EXPECT_EQ(GetLocMode(0xA8, TIC28X::AMODE_0, loc32).kind,
+            TIC28X::LOC_INVALID);
+
+  // Circular
+  EXPECT_EQ(GetLocMode(0xBF, TIC28X::AMODE_0, loc16).kind,
+            TIC28X::LOC_CIRCULAR);
+  EXPECT_EQ(GetLocMode(0xBF, TIC28X::AMODE_1, loc16).kind,
+            TIC28X::LOC_CIRCULAR_INDEXED);
+}
+
+// Every valid code renders text and every invalid code is rejected
+TEST(TestAddressing, Text) {
+  for (const auto amode : {TIC28X::AMODE_0, TIC28X::AMODE_1}) {
+    for (uint32_t loc = 0; loc <= 0xFF; loc++) {
+      const TIC28X::LocTextInfo lti = {.loc = static_cast<uint8_t>(loc),
+                                       .amode = amode};
+      std::vector<BN::InstructionTextToken> loc16, loc32;
+      EXPECT_EQ(TIC28X::Loc16Text(lti, loc16),
+                GetLocMode(loc, amode, TIC28X::OPERAND_LOC16).kind !=
+                    TIC28X::LOC_INVALID);
+      EXPECT_EQ(TIC28X::Loc32Text(lti, loc32),
+                GetLocMode(loc, amode, TIC28X::OPERAND_LOC32).kind !=
+                    TIC28X::LOC_INVALID);
+      EXPECT_EQ(loc16.empty(), GetLocMode(loc, amode, TIC28X::OPERAND_LOC16)
+                                   .kind == TIC28X::LOC_INVALID);
+    }
+  }
+}
+
+// The C2xLP forms keep their established token types and separators
+TEST(TestAddressing, ArpTextTokens) {
+  const auto render = [](const uint8_t loc, const TIC28X::AddressMode amode) {
+    std::vector<BN::InstructionTextToken> tokens;
+    TIC28X::Loc16Text({.loc = loc, .amode = amode}, tokens);
+    return tokens;
+  };
+
+  const auto ar0_postinc = render(0xBB, TIC28X::AMODE_1);  // *0++
+  ASSERT_EQ(ar0_postinc.size(), 3u);
+  EXPECT_EQ(ar0_postinc[1].type, IntegerToken);
+  EXPECT_EQ(ar0_postinc[1].text, "0");
+
+  const auto ar0_postinc_arp = render(0xD2, TIC28X::AMODE_1);  // *0++,ARP2
+  ASSERT_EQ(ar0_postinc_arp.size(), 5u);
+  EXPECT_EQ(ar0_postinc_arp[1].type, TextToken);
+  EXPECT_EQ(ar0_postinc_arp[3].text, ", ");
+
+  const auto br0_postdec_arp = render(0xEB, TIC28X::AMODE_1);  // *BR0--,ARP3
+  ASSERT_EQ(br0_postdec_arp.size(), 5u);
+  EXPECT_EQ(br0_postdec_arp[3].type, OperandSeparatorToken);
+  EXPECT_EQ(br0_postdec_arp[3].text, ",");
+  EXPECT_EQ(br0_postdec_arp[4].text, "arp3");
+}
+
+// The pre-rendered tokens are exactly what LocText renders
+TEST(TestAddressing, PrerenderedTokens) {
+  for (const auto amode : {TIC28X::AMODE_0, TIC28X::AMODE_1}) {
+    for (uint32_t loc = 0; loc <= 0xFF; loc++) {
+      const TIC28X::LocTextInfo lti = {.loc = static_cast<uint8_t>(loc),
+                                       .amode = amode};
+      std::vector<BN::InstructionTextToken> want, got;
+      TIC28X::LocText(GetLocMode(loc, amode, TIC28X::OPERAND_LOC32), want);
+      TIC28X::Loc32Text(lti, got);
+      ASSERT_EQ(want.size(), got.size()) << loc;
+      for (size_t i = 0; i < want.size(); i++) {
+        EXPECT_EQ(want[i].type, got[i].type) << loc;
+        EXPECT_EQ(want[i].text, got[i].text) << loc;
+        EXPECT_EQ(want[i].value, got[i].value) << loc;
+      }
+    }
+  }
+}
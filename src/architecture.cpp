@@ -5,44 +5,127 @@
 
 #include <binaryninjaapi.h>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
+#include <utility>
 
+#include "cache.h"
+#include "decoder.h"
 #include "flags.h"
 #include "instructions.h"
+#include "instrumentation.h"
 #include "registers.h"
+#include "registry.h"
 #include "sizes.h"
 #include "text.h"
 #include "util.h"
+#include "views.h"
 
 namespace BN = BinaryNinja;
 
 namespace TIC28X {
-TIC28XArchitecture::TIC28XArchitecture(const std::string& name)
-    : Architecture(name) {
-  // Set default modes
-  OBJMODE = OBJMODE_0;
-  AMODE = AMODE_0;
-  INSTRUCTIONS = GenerateInstructionVector();
+namespace {
+// Registers::INFO in the form Binary Ninja asks for, built at compile time
+constexpr std::array<BNRegisterInfo, Registers::COUNT> REGISTER_INFO = [] {
+  std::array<BNRegisterInfo, Registers::COUNT> info = {};
+  for (size_t reg = 0; reg < Registers::COUNT; reg++) {
+    const auto [fullWidthReg, offset, size, zextend] = Registers::INFO[reg];
+    info[reg] = BNRegisterInfo{
+        .fullWidthRegister = fullWidthReg,
+        .offset = offset,
+        .size = size,
+        .extend = zextend ? ZeroExtendToFullWidth : NoExtend,
+    };
+  }
+  return info;
+}();
+}  // namespace
+
+TIC28XArchitecture::TIC28XArchitecture(const std::string& name,
+                                       const ObjectMode objmode,
+                                       const AddressMode amode,
+                                       const size_t text_cache_entries,
+                                       ByteReader byte_reader)
+    : TIC28XArchitecture(name, objmode, amode,
+                         text_cache_entries
+                             ? std::make_shared<TextCache>(text_cache_entries)
+                             : nullptr,
+                         std::move(byte_reader)) {}
+
+TIC28XArchitecture::TIC28XArchitecture(const std::string& name,
+                                       const ObjectMode objmode,
+                                       const AddressMode amode,
+                                       std::shared_ptr<TextCache> text_cache,
+                                       ByteReader byte_reader)
+    : Architecture(name),
+      OBJMODE(objmode),
+      AMODE(amode),
+      DECODE_TABLE(GetDecodeTable(objmode)),
+      TEXT_CACHE(std::move(text_cache)),
+      REPEAT_ADDRS(std::make_unique<RepeatSet>()),
+      BYTE_READER(std::move(byte_reader)) {}
+
+TIC28XArchitecture::~TIC28XArchitecture() = default;
+
+// Insert an address into the repeat address set
+void TIC28XArchitecture::AddRepeatAddr(const uint64_t addr) {
+  REPEAT_ADDRS->Insert(addr);
 }
 
-TIC28XArchitecture::~TIC28XArchitecture() { INSTRUCTIONS.clear(); }
+// Forget every repeated address, e.g. once no view uses the architecture
+void TIC28XArchitecture::ClearRepeatAddrs() {
+  REPEAT_ADDRS->Clear();
+}
 
-void TIC28XArchitecture::SetObjmode(const ObjectMode mode) { OBJMODE = mode; }
+// Check to see if an address is repeated
+bool TIC28XArchitecture::IsRepeatAddr(const uint64_t addr) const {
+  return REPEAT_ADDRS->Contains(addr);
+}
 
-void TIC28XArchitecture::SetAmode(const AddressMode mode) { AMODE = mode; }
 
-// Safely insert an address into the repeat address set
-void TIC28XArchitecture::AddRepeatAddr(const uint64_t addr) {
-  std::lock_guard lock(REPEAT_ADDR_MUTEX);
-  REPEAT_ADDRS.insert(addr);
+/**
+ * LookBehind - decides from the bytes before an instruction whether it
+ * follows an RPT (see IsRepeatPrefix).
+ *
+ * @param addr - address of the instruction
+ * @return whether the instruction is repeated, or std::nullopt if there is
+ * no byte reader, the bytes cannot be read or they are ambiguous
+ */
+std::optional<bool> TIC28XArchitecture::LookBehind(const uint64_t addr) const {
+  std::array<uint8_t, Sizes::_4_BYTES> prev;
+  if (!BYTE_READER || addr < prev.size() ||
+      !BYTE_READER(*this, addr - prev.size(), prev.data(), prev.size())) {
+    return std::nullopt;
+  }
+  return IsRepeatPrefix(prev.data(), DECODE_TABLE);
+}
+
+/**
+ * IsRepeated - checks whether the instruction at an address follows an RPT.
+ *
+ * The instruction must have been recorded by RPT Info. A recorded address
+ * is only dropped if the bytes before it show for certain that it no longer
+ * follows an RPT, e.g. after the view was patched; bytes that cannot be read
+ * or are ambiguous keep it.
+ *
+ * @param addr - address of the instruction
+ * @return true if the instruction is repeated
+ */
+bool TIC28XArchitecture::IsRepeated(const uint64_t addr) const {
+  return IsRepeatAddr(addr) && LookBehind(addr) != false;
+}
+
+// Text cache statistics, for sizing the cache; 0 if it is disabled. Counts
+// every architecture sharing the cache.
+uint64_t TIC28XArchitecture::GetTextCacheHits() const {
+  return TEXT_CACHE ? TEXT_CACHE->GetStats().hits : 0;
 }
 
-// Safely check to see if an address is repeated
-bool TIC28XArchitecture::IsRepeatAddr(const uint64_t addr) {
-  std::lock_guard lock(REPEAT_ADDR_MUTEX);
-  return REPEAT_ADDRS.contains(addr);
+uint64_t TIC28XArchitecture::GetTextCacheMisses() const {
+  return TEXT_CACHE ? TEXT_CACHE->GetStats().misses : 0;
 }
 
 BNRegisterInfo TIC28XArchitecture::RegisterInfo(const uint32_t fullWidthReg,
@@ -83,54 +166,35 @@ BNRegisterInfo TIC28XArchitecture::RegisterInfo(const uint32_t fullWidthReg,
   return Sizes::_2_BYTES;
 }
 
+// The result has to be a new vector, but it is copied straight out of a
+// compile-time table
 [[nodiscard]] std::vector<uint32_t> TIC28XArchitecture::GetAllRegisters() {
-  return std::vector<uint32_t>{
-      Registers::ACC,  Registers::AH,   Registers::AL,     Registers::XAR0,
-      Registers::XAR1, Registers::XAR2, Registers::XAR3,   Registers::XAR4,
-      Registers::XAR5, Registers::XAR6, Registers::XAR7,   Registers::AR0,
-      Registers::AR1,  Registers::AR2,  Registers::AR3,    Registers::AR4,
-      Registers::AR5,  Registers::AR6,  Registers::AR7,    Registers::AR0H,
-      Registers::AR1H, Registers::AR2H, Registers::AR3H,   Registers::AR4H,
-      Registers::AR5H, Registers::AR6H, Registers::AR7H,   Registers::BR0,
-      Registers::BR1,  Registers::BR2,  Registers::BR3,    Registers::BR4,
-      Registers::BR5,  Registers::BR6,  Registers::BR7,    Registers::DP,
-      Registers::IFR,  Registers::IER,  Registers::DBGIER, Registers::P,
-      Registers::PH,   Registers::PL,   Registers::PC,     Registers::RPC,
-      Registers::SP,   Registers::ST0,  Registers::ST1,    Registers::XT,
-      Registers::T,    Registers::TL,   Registers::TH,
-  };
+  return {Registers::ALL.begin(), Registers::ALL.end()};
 }
 
 [[nodiscard]] BNRegisterInfo TIC28XArchitecture::GetRegisterInfo(
     const uint32_t reg) {
-  if (Registers::INFO.contains(reg)) {
-    const auto [fullWidthReg, offset, size, zextend] = Registers::INFO.at(reg);
-    return RegisterInfo(fullWidthReg, offset, size, zextend);
+  if (reg < Registers::COUNT) {
+    return REGISTER_INFO[reg];
   }
   return RegisterInfo(0, 0, 0);
 }
 
 [[nodiscard]] std::string TIC28XArchitecture::GetRegisterName(
     const uint32_t reg) {
-  if (Registers::NAMES.contains(reg)) {
-    return Registers::NAMES.at(reg);
+  if (reg < Registers::COUNT) {
+    return Registers::NAMES[reg];
   }
   return "INVALID_REGISTER_ID";
 }
 
 [[nodiscard]] std::vector<uint32_t> TIC28XArchitecture::GetAllFlags() {
-  return std::vector<uint32_t>{
-      Flags::SXM,      Flags::OVM,   Flags::TC,      Flags::C,
-      Flags::Z,        Flags::N,     Flags::V,       Flags::PM,
-      Flags::OVC,      Flags::INTM,  Flags::DBGM,    Flags::PAGE0,
-      Flags::VMAP,     Flags::SPA,   Flags::LOOP,    Flags::EALLOW,
-      Flags::IDLESTAT, Flags::AMODE, Flags::OBJMODE, Flags::M0M1MAP,
-      Flags::XF,       Flags::ARP};
+  return {Flags::ALL.begin(), Flags::ALL.end()};
 }
 
 [[nodiscard]] std::string TIC28XArchitecture::GetFlagName(uint32_t flag) {
-  if (Flags::NAMES.contains(flag)) {
-    return Flags::NAMES.at(flag);
+  if (flag < Flags::COUNT) {
+    return Flags::NAMES[flag];
   }
   return "INVALID_FLAG";
 }
@@ -174,8 +238,10 @@ bool TIC28XArchitecture::GetInstructionInfo(const uint8_t* data,
                                             const uint64_t addr,
                                             const size_t maxLen,
                                             BN::InstructionInfo& result) {
-  if (const auto i = DecodeInstruction(data, INSTRUCTIONS, OBJMODE)) {
-    return i->get()->Info(data, addr, result, this);
+  TIC28X_TIME(CALLBACK_INFO);
+  if (const auto decoded = Decode(data, addr, DECODE_TABLE)) {
+    TIC28X_PROFILE_DECODE(*decoded, AMODE);
+    return GetInstruction(*decoded)->Info(*decoded, addr, result, this);
   }
   return false;
 }
@@ -183,22 +249,50 @@ bool TIC28XArchitecture::GetInstructionInfo(const uint8_t* data,
 bool TIC28XArchitecture::GetInstructionText(
     const uint8_t* data, const uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result) {
-  if (const auto i = DecodeInstruction(data, INSTRUCTIONS, OBJMODE)) {
-    // Check to see if we need to generate repeat text (||) for this instruction
-    if (i->get()->IsRepeatable() && IsRepeatAddr(addr)) {
-      result.emplace_back(TextToken, "|| ");
+  TIC28X_TIME(CALLBACK_TEXT);
+  const auto decoded = Decode(data, addr, DECODE_TABLE);
+  if (!decoded) {
+    return false;
+  }
+  TIC28X_PROFILE_DECODE(*decoded, AMODE);
+  const auto i = GetInstruction(*decoded);
+
+  // Size the result once, with room for the repeat prefix
+  result.reserve(result.size() + Registry::MAX_TOKENS[decoded->id] + 1);
+
+  // Check to see if we need to generate repeat text (||) for this instruction
+  if (i->IsRepeatable() && IsRepeated(addr)) {
+    result.emplace_back(TextToken, "|| ");
+  }
+
+  const size_t start = result.size();
+  const bool cacheable =
+      TEXT_CACHE && Registry::ADDRESS_INDEPENDENT[decoded->id];
+  if (cacheable) {
+    if (TEXT_CACHE->Lookup(*decoded, AMODE, len, result)) {
+      TIC28X_COUNT(EVENT_TEXT_CACHE_HIT);
+      return true;
     }
-    return i->get()->Text(data, addr, len, result, AMODE);
+    TIC28X_COUNT(EVENT_TEXT_CACHE_MISS);
   }
-  return false;
+  if (!i->Text(*decoded, addr, len, result, AMODE)) {
+    return false;
+  }
+  if (cacheable) {
+    TEXT_CACHE->Insert(*decoded, AMODE, len,
+                       std::span(result).subspan(start));
+  }
+  return true;
 }
 
 bool TIC28XArchitecture::GetInstructionLowLevelIL(const uint8_t* data,
                                                   const uint64_t addr,
                                                   size_t& len,
                                                   BN::LowLevelILFunction& il) {
-  if (const auto i = DecodeInstruction(data, INSTRUCTIONS, OBJMODE)) {
-    return i->get()->Lift(data, addr, len, il, this);
+  TIC28X_TIME(CALLBACK_LIFT);
+  if (const auto decoded = Decode(data, addr, DECODE_TABLE)) {
+    TIC28X_PROFILE_DECODE(*decoded, AMODE);
+    return GetInstruction(*decoded)->Lift(*decoded, addr, len, il, this);
   }
   return false;
 }
@@ -207,23 +301,58 @@ bool TIC28XArchitecture::GetInstructionLowLevelIL(const uint8_t* data,
 extern "C" {
 BN_DECLARE_CORE_ABI_VERSION
 BINARYNINJAPLUGIN bool CorePluginInit() {
-  const auto tic28x_c27x = new TIC28X::TIC28XArchitecture("tic28x_c27x");
-  const auto tic28x_c2xlp = new TIC28X::TIC28XArchitecture("tic28x_c2xlp");
-  const auto tic28x = new TIC28X::TIC28XArchitecture("tic28x");
+  // Each arch is fixed to one compatibility mode. The instruction and decode
+  // tables are compile-time constants every arch already shares, and all
+  // three share one text cache, so common encodings are rendered once.
+  //
+  // Nothing but the archs, their repeat address sets and their registrations
+  // is allocated here: the text cache allocates its table the first time it
+  // is used. Like the archs, it is never destroyed, and the archs only borrow
+  // it, so sharing it needs no control block.
+  static TIC28X::Immortal<TIC28X::TextCache> text_cache;
+  const std::shared_ptr<TIC28X::TextCache> shared_text_cache(
+      std::shared_ptr<void>(), &text_cache.value);
+
+  // The open views let the archs read the bytes before an instruction, and
+  // the repeat addresses every view of an arch shares are dropped once its
+  // last view closes
+  static TIC28X::Immortal<TIC28X::OpenViews> views;
+  const TIC28X::ByteReader byte_reader =
+      [](const TIC28X::TIC28XArchitecture& arch, const uint64_t addr,
+         uint8_t* data, const size_t len) {
+        return views.value.Read(arch, addr, data, len);
+      };
+
+  const auto tic28x_c27x = new TIC28X::TIC28XArchitecture(
+      "tic28x_c27x", TIC28X::OBJMODE_0, TIC28X::AMODE_0, shared_text_cache,
+      byte_reader);
+  const auto tic28x_c2xlp = new TIC28X::TIC28XArchitecture(
+      "tic28x_c2xlp", TIC28X::OBJMODE_1, TIC28X::AMODE_1, shared_text_cache,
+      byte_reader);
+  const auto tic28x = new TIC28X::TIC28XArchitecture(
+      "tic28x", TIC28X::OBJMODE_1, TIC28X::AMODE_0, shared_text_cache,
+      byte_reader);
+
+  for (const auto arch : {tic28x_c27x, tic28x_c2xlp, tic28x}) {
+    views.value.Track(arch);
+  }
+  BN::BinaryViewType::RegisterBinaryViewFinalizationEvent(
+      [](BN::BinaryView* view) { views.value.Add(view); });
 
   BN::Architecture::Register(tic28x_c27x);
   BN::Architecture::Register(tic28x_c2xlp);
   BN::Architecture::Register(tic28x);
 
-  // Set compatibility modes for each arch
-  tic28x_c27x->SetObjmode(TIC28X::OBJMODE_0);
-  tic28x_c27x->SetAmode(TIC28X::AMODE_0);
-
-  tic28x_c2xlp->SetObjmode(TIC28X::OBJMODE_1);
-  tic28x_c2xlp->SetAmode(TIC28X::AMODE_1);
-
-  tic28x->SetObjmode(TIC28X::OBJMODE_1);
-  tic28x->SetAmode(TIC28X::AMODE_0);
+#ifdef TIC28X_INSTRUMENTATION
+  BN::PluginCommand::Register(
+      "TI C28x\\Log Instrumentation",
+      "Logs the TI C28x callback counters and latencies as JSON",
+      [](BN::BinaryView*) {
+        const auto json = TIC28X::Instrumentation::ToJson(
+            TIC28X::Instrumentation::Collect());
+        BN::LogInfo("%s", json.c_str());
+      });
+#endif
 
   // TODO: calling conventions
   //    Ref<CallingConvention> cc = new TIC28XCallingConvention(tic28x);
@@ -6,10 +6,18 @@
 
 #include <binaryninjaapi.h>
 
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
 namespace BN = BinaryNinja;
 
 namespace TIC28X {
 class TIC28XArchitecture;
+class TextCache;
+class RepeatSet;
+class DecodeTable;
 /**
  * Compatibility Modes
  * C28x Mode: OBJMODE = 1; AMODE = 0;
@@ -19,6 +27,37 @@ class TIC28XArchitecture;
 enum ObjectMode { OBJMODE_0 = 0, OBJMODE_1 = 1, OBJMODE_ANY = 2 };
 enum AddressMode { AMODE_0 = 0, AMODE_1 = 1 };
 
+/**
+ * Branch Kinds
+ * Summarizes the branches an instruction's Info method adds, so that bulk
+ * decoders can classify control flow without building an InstructionInfo.
+ */
+enum BranchKind : uint8_t {
+  BRANCH_NONE = 0,
+  BRANCH_UNCONDITIONAL,
+  BRANCH_CONDITIONAL,
+  BRANCH_CALL,
+  BRANCH_RETURN,
+  BRANCH_CONDITIONAL_RETURN,
+  BRANCH_INDIRECT,
+  BRANCH_EXCEPTION
+};
+
+/**
+ * DecodedInstruction - everything decoding an instruction at an address
+ * produces. It is filled in once per decode and handed to Info, Text and Lift,
+ * which extract their operands from word instead of re-reading the opcode
+ * data. It is plain data, so it can be copied freely and cached.
+ */
+struct DecodedInstruction {
+  uint64_t target;    // static branch target, or 0 (see BranchKind)
+  uint32_t word;      // opcode, as built by DataToOpcode for length bytes
+  uint16_t id;        // instruction id (see Registry)
+  uint8_t length;     // instruction length in bytes
+  BranchKind branch;  // branches added by Info
+};
+static_assert(std::is_trivially_copyable_v<DecodedInstruction>);
+
 /**
  * Abstract instruction class that all instructions must use.
  * This allows the return type of the decoder function (DecodeInstruction) to
@@ -40,42 +79,77 @@ class Instruction {
 
   /* Binary Ninja Functions */
   // TODO: make pure virtual
-  virtual bool Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+  virtual bool Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     AddressMode amode);
 
-  virtual bool Info(const uint8_t* data, uint64_t addr,
+  virtual bool Info(const DecodedInstruction& decoded, uint64_t addr,
                     BN::InstructionInfo& result, TIC28XArchitecture* arch) = 0;
 
   // TODO: make pure virtual
-  virtual bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
-                    BN::LowLevelILFunction& il, TIC28XArchitecture* arch);
+  virtual bool Lift(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, BN::LowLevelILFunction& il,
+                    TIC28XArchitecture* arch);
 };
 
+/**
+ * ByteReader - reads len bytes at addr into data from the views being analyzed
+ * with arch, returning false if they cannot be read. Lets the architecture
+ * look at the bytes around an instruction, which Binary Ninja's callbacks do
+ * not pass.
+ */
+using ByteReader = std::function<bool(const TIC28XArchitecture& arch,
+                                      uint64_t addr, uint8_t* data,
+                                      size_t len)>;
+
 class TIC28XArchitecture final : public BN::Architecture {
  protected:
   static BNRegisterInfo RegisterInfo(uint32_t fullWidthReg, size_t offset,
                                      size_t size, bool zeroExtend = false);
-  // INSTRUCTIONS is a vector of pointers to all possible CPU instructions.
-  std::vector<std::optional<std::shared_ptr<Instruction>>> INSTRUCTIONS;
+  // Object and address modes are fixed by the desired compatibility mode
+  const ObjectMode OBJMODE;
+  const AddressMode AMODE;
 
-  // Object and address modes are set based on the desired compatibility mode
-  ObjectMode OBJMODE;
-  AddressMode AMODE;
+  // DECODE_TABLE maps opcodes to the Instructions that are valid in OBJMODE.
+  // It is generated at compile time (see decoder.h).
+  const DecodeTable& DECODE_TABLE;
 
-  // Track instruction repeats (RPT inst)
-  // TODO: do these need to be tracked in the view?
-  // Will opening multiple samples in the same binja window share this set?
-  std::unordered_set<uint64_t> REPEAT_ADDRS;
-  std::mutex REPEAT_ADDR_MUTEX;
+  // TEXT_CACHE memoizes the text of address independent instructions by
+  // encoding, or is null if disabled (see cache.h). Its keys include the
+  // instruction id and address mode, so architectures may share one.
+  std::shared_ptr<TextCache> TEXT_CACHE;
+
+  // REPEAT_ADDRS tracks the instructions RPT repeats (see cache.h). Binary
+  // Ninja does not say which view a callback is for, so all views share it
+  // until the last of them closes (see OpenViews).
+  const std::unique_ptr<RepeatSet> REPEAT_ADDRS;
+
+  // BYTE_READER, if set, lets IsRepeated look behind an instruction to drop
+  // REPEAT_ADDRS that no longer follow an RPT (see OpenViews::Read)
+  const ByteReader BYTE_READER;
 
  public:
-  void SetObjmode(ObjectMode mode);
-  void SetAmode(AddressMode mode);
+  [[nodiscard]] ObjectMode GetObjmode() const { return OBJMODE; }
+  [[nodiscard]] AddressMode GetAmode() const { return AMODE; }
+  [[nodiscard]] uint64_t GetTextCacheHits() const;
+  [[nodiscard]] uint64_t GetTextCacheMisses() const;
   void AddRepeatAddr(uint64_t addr);
-  bool IsRepeatAddr(uint64_t addr);
-
-  explicit TIC28XArchitecture(const std::string& name);
+  void ClearRepeatAddrs();
+  [[nodiscard]] bool IsRepeatAddr(uint64_t addr) const;
+  [[nodiscard]] std::optional<bool> LookBehind(uint64_t addr) const;
+  [[nodiscard]] bool IsRepeated(uint64_t addr) const;
+
+  // Default number of encodings the text cache holds; 0 disables it
+  static constexpr size_t TEXT_CACHE_ENTRIES = 1 << 12;
+
+  explicit TIC28XArchitecture(const std::string& name,
+                              ObjectMode objmode = OBJMODE_0,
+                              AddressMode amode = AMODE_0,
+                              size_t text_cache_entries = TEXT_CACHE_ENTRIES,
+                              ByteReader byte_reader = nullptr);
+  TIC28XArchitecture(const std::string& name, ObjectMode objmode,
+                     AddressMode amode, std::shared_ptr<TextCache> text_cache,
+                     ByteReader byte_reader = nullptr);
   ~TIC28XArchitecture() override;
 
   size_t GetAddressSize() const override;
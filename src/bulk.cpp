@@ -0,0 +1,205 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "bulk.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define TIC28X_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define TIC28X_TARGET_AVX2
+#else
+#define TIC28X_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace TIC28X {
+namespace {
+/* Scalar Kernels */
+void Lookup16Scalar(const uint8_t* data, const size_t count,
+                    const DecodeTable& table, uint16_t* out) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = table.Lookup16(data[2 * i + 1] << 8 | data[2 * i]);
+  }
+}
+
+void LookupLengthsScalar(const uint8_t* data, const size_t count,
+                         const LengthTable& table, uint8_t* out) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = table.Lookup(data[2 * i + 1] << 8 | data[2 * i]);
+  }
+}
+
+void SwizzleWordsScalar(const uint8_t* data, const size_t count,
+                        uint32_t* out) {
+  if (count == 0) {
+    return;
+  }
+  for (size_t i = 0; i + 1 < count; i++) {
+    out[i] = data[2 * i + 1] << 24 | data[2 * i] << 16 |
+             data[2 * i + 3] << 8 | data[2 * i + 2];
+  }
+  out[count - 1] = data[2 * count - 1] << 24 | data[2 * count - 2] << 16;
+}
+
+constexpr BulkKernels SCALAR_KERNELS = {
+    .name = "scalar",
+    .lookup16 = Lookup16Scalar,
+    .lookup_lengths = LookupLengthsScalar,
+    .swizzle_words = SwizzleWordsScalar,
+};
+
+#ifdef TIC28X_X86
+/* AVX2 Kernels */
+
+// Reorders the result of a 256-bit pack, which packs each 128-bit lane
+// separately, back into element order
+TIC28X_TARGET_AVX2 __m256i Pack32To16(const __m256i lo, const __m256i hi) {
+  return _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8);
+}
+
+// Lengths of 8 halfwords, zero extended to 32 bits
+TIC28X_TARGET_AVX2 __m256i GatherLengths(const int* packed,
+                                         const __m256i ops) {
+  const __m256i three = _mm256_set1_epi32(3);
+  const __m256i fields =
+      _mm256_i32gather_epi32(packed, _mm256_srli_epi32(ops, 2), 1);
+  const __m256i shifts = _mm256_slli_epi32(_mm256_and_si256(ops, three), 1);
+  return _mm256_slli_epi32(
+      _mm256_and_si256(_mm256_srlv_epi32(fields, shifts), three), 1);
+}
+
+TIC28X_TARGET_AVX2 void Lookup16Avx2(const uint8_t* data, const size_t count,
+                                     const DecodeTable& table, uint16_t* out) {
+  const auto entries = reinterpret_cast<const int*>(table.GetEntries());
+  const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m256i ops =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 2 * i));
+    const __m256i lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(ops));
+    const __m256i hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(ops, 1));
+    const __m256i lo_entries =
+        _mm256_and_si256(_mm256_i32gather_epi32(entries, lo, 2), low16);
+    const __m256i hi_entries =
+        _mm256_and_si256(_mm256_i32gather_epi32(entries, hi, 2), low16);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        Pack32To16(lo_entries, hi_entries));
+  }
+  Lookup16Scalar(data + 2 * i, count - i, table, out + i);
+}
+
+TIC28X_TARGET_AVX2 void LookupLengthsAvx2(const uint8_t* data,
+                                          const size_t count,
+                                          const LengthTable& table,
+                                          uint8_t* out) {
+  const auto packed = reinterpret_cast<const int*>(table.GetPacked());
+
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m256i ops =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 2 * i));
+    const __m256i lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(ops));
+    const __m256i hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(ops, 1));
+    const __m256i lengths =
+        Pack32To16(GatherLengths(packed, lo), GatherLengths(packed, hi));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(_mm256_castsi256_si128(lengths),
+                                      _mm256_extracti128_si256(lengths, 1)));
+  }
+  LookupLengthsScalar(data + 2 * i, count - i, table, out + i);
+}
+
+TIC28X_TARGET_AVX2 void SwizzleWordsAvx2(const uint8_t* data,
+                                         const size_t count, uint32_t* out) {
+  // Word k of each 128-bit lane is halfword k + 1 below halfword k, so each
+  // lane turns 5 halfwords into 4 words
+  const __m256i swizzle =
+      _mm256_setr_epi8(2, 3, 0, 1, 4, 5, 2, 3, 6, 7, 4, 5, 8, 9, 6, 7,  //
+                       2, 3, 0, 1, 4, 5, 2, 3, 6, 7, 4, 5, 8, 9, 6, 7);
+  const auto load = [](const uint8_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  };
+
+  // Each step reads 20 halfwords (the last lane loads 8) to make 16 words
+  size_t i = 0;
+  for (; i + 20 <= count; i += 16) {
+    const uint8_t* p = data + 2 * i;
+    const __m256i a = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(load(p)), load(p + 8), 1);
+    const __m256i b = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(load(p + 16)), load(p + 24), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_shuffle_epi8(a, swizzle));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 8),
+                        _mm256_shuffle_epi8(b, swizzle));
+  }
+  SwizzleWordsScalar(data + 2 * i, count - i, out + i);
+}
+
+constexpr BulkKernels AVX2_KERNELS = {
+    .name = "avx2",
+    .lookup16 = Lookup16Avx2,
+    .lookup_lengths = LookupLengthsAvx2,
+    .swizzle_words = SwizzleWordsAvx2,
+};
+
+bool HasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  int regs[4];
+  __cpuid(regs, 0);
+  if (regs[0] < 7) {
+    return false;
+  }
+  // The OS must also save the YMM registers
+  __cpuid(regs, 1);
+  const bool osxsave = regs[2] & 1 << 27;
+  const bool avx = regs[2] & 1 << 28;
+  if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuidex(regs, 7, 0);
+  return regs[1] & 1 << 5;
+#else
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+}  // namespace
+
+/**
+ * GetScalarKernels - returns the portable bulk kernels.
+ *
+ * @return scalar kernels
+ */
+const BulkKernels& GetScalarKernels() { return SCALAR_KERNELS; }
+
+/**
+ * GetAvx2Kernels - returns the AVX2 bulk kernels if this CPU supports them.
+ *
+ * @return AVX2 kernels, or nullptr
+ */
+const BulkKernels* GetAvx2Kernels() {
+#ifdef TIC28X_X86
+  static const bool supported = HasAvx2();
+  return supported ? &AVX2_KERNELS : nullptr;
+#else
+  return nullptr;
+#endif
+}
+
+/**
+ * GetBulkKernels - returns the fastest bulk kernels this CPU supports. The
+ * CPU is only checked on the first call.
+ *
+ * @return bulk kernels
+ */
+const BulkKernels& GetBulkKernels() {
+  static const BulkKernels& kernels =
+      GetAvx2Kernels() ? *GetAvx2Kernels() : GetScalarKernels();
+  return kernels;
+}
+}  // namespace TIC28X
@@ -0,0 +1,41 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_BULK_H
+#define TIC28X_BULK_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "decoder.h"
+
+namespace TIC28X {
+/**
+ * BulkKernels - inner loops for decoding many consecutive halfwords at once.
+ *
+ * Every kernel treats data as a run of count halfwords, where halfword i
+ * starts at data + 2 * i, and writes exactly count results:
+ *  - lookup16 - first-level DecodeTable entry of each halfword
+ *  - lookup_lengths - LengthTable length of each halfword
+ *  - swizzle_words - DataToOpcode(data + 2 * i, 4) for each halfword; the
+ *    last word's LSW is read as 0, so only count halfwords are read
+ *
+ * The scalar kernels run anywhere. The AVX2 kernels swizzle 16 halfwords per
+ * step with byte shuffles and do the table lookups with gathers. The best
+ * kernels for this CPU are picked once, using CPUID.
+ */
+struct BulkKernels {
+  const char* name;
+  void (*lookup16)(const uint8_t* data, size_t count, const DecodeTable& table,
+                   uint16_t* out);
+  void (*lookup_lengths)(const uint8_t* data, size_t count,
+                         const LengthTable& table, uint8_t* out);
+  void (*swizzle_words)(const uint8_t* data, size_t count, uint32_t* out);
+};
+
+const BulkKernels& GetBulkKernels();
+const BulkKernels& GetScalarKernels();
+const BulkKernels* GetAvx2Kernels();
+}  // namespace TIC28X
+
+#endif  // TIC28X_BULK_H
@@ -0,0 +1,61 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "bulk.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "test_util.h"
+#include "util.h"
+
+// Verify a set of bulk kernels against single halfword lookups, for counts
+// that do and do not fill whole vector steps
+static void test_kernels(const TIC28X::BulkKernels& kernels) {
+  const auto data = random_bytes(2 * 4099);
+
+  for (const auto objmode : ALL_OBJMODES) {
+    const auto& table = TIC28X::GetDecodeTable(objmode);
+    const auto& lengths = TIC28X::GetLengthTable(objmode);
+
+    for (const size_t count : {0, 1, 15, 16, 17, 19, 20, 21, 36, 4099}) {
+      std::vector<uint16_t> entries(count);
+      std::vector<uint8_t> lens(count);
+      std::vector<uint32_t> words(count);
+      kernels.lookup16(data.data(), count, table, entries.data());
+      kernels.lookup_lengths(data.data(), count, lengths, lens.data());
+      kernels.swizzle_words(data.data(), count, words.data());
+
+      for (size_t i = 0; i < count; i++) {
+        const uint8_t* op = data.data() + 2 * i;
+        const uint16_t op16 = DataToOpcode(op, 2);
+        const uint32_t op32 =
+            i + 1 < count ? DataToOpcode(op, 4) : uint32_t{op16} << 16;
+        ASSERT_EQ(table.Lookup16(op16), entries[i])
+            << kernels.name << " count " << count << " i " << i;
+        ASSERT_EQ(lengths.Lookup(op16), lens[i])
+            << kernels.name << " count " << count << " i " << i;
+        ASSERT_EQ(op32, words[i])
+            << kernels.name << " count " << count << " i " << i;
+      }
+    }
+  }
+}
+
+TEST(TestBulkKernels, Scalar) { test_kernels(TIC28X::GetScalarKernels()); }
+
+TEST(TestBulkKernels, Avx2) {
+  const auto kernels = TIC28X::GetAvx2Kernels();
+  if (!kernels) {
+    GTEST_SKIP() << "AVX2 is not supported";
+  }
+  test_kernels(*kernels);
+}
+
+// The dispatched kernels must be one of the known implementations
+TEST(TestBulkKernels, Dispatch) {
+  const auto& kernels = TIC28X::GetBulkKernels();
+  EXPECT_TRUE(&kernels == &TIC28X::GetScalarKernels() ||
+              &kernels == TIC28X::GetAvx2Kernels());
+}
@@ -0,0 +1,211 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "cache.h"
+
+#include <algorithm>
+#include <bit>
+#include <string_view>
+
+#include "hot_instructions.h"
+#include "registry.h"
+
+namespace TIC28X {
+namespace {
+// Instruction ids listed in HOT_INSTRUCTIONS
+constexpr std::array<bool, Registry::COUNT> PINNED = [] {
+  std::array<bool, Registry::COUNT> pinned = {};
+  for (const std::string_view name : HOT_INSTRUCTIONS) {
+    for (size_t id = 0; id < Registry::COUNT; id++) {
+      pinned[id] = pinned[id] || name == Registry::FULL_NAMES[id];
+    }
+  }
+  return pinned;
+}();
+
+static_assert(
+    [] {
+      size_t count = 0;
+      for (size_t id = 0; id < Registry::COUNT; id++) {
+        if (PINNED[id] && !Registry::ADDRESS_INDEPENDENT[id]) {
+          return false;
+        }
+        count += PINNED[id];
+      }
+      return count == HOT_INSTRUCTIONS.size();
+    }(),
+    "HOT_INSTRUCTIONS must name distinct, address independent instructions");
+}  // namespace
+
+/**
+ * TextCache - creates an empty text cache.
+ *
+ * @param capacity - maximum number of cached encodings, rounded up to a power
+ * of two
+ */
+TextCache::TextCache(const size_t capacity)
+    : CAPACITY(std::bit_ceil(std::max<size_t>(capacity, 1))) {}
+
+std::vector<TextCache::Entry>& TextCache::GetEntries() {
+  std::call_once(ENTRIES_ONCE, [this] { ENTRIES.resize(CAPACITY); });
+  return ENTRIES;
+}
+
+// The instruction id separates 16-bit and 32-bit encodings of the same word
+uint64_t TextCache::Key(const DecodedInstruction& decoded,
+                        const AddressMode amode) {
+  return uint64_t{decoded.word} | uint64_t{decoded.id} << 32 |
+         uint64_t{amode} << 48;
+}
+
+size_t TextCache::Slot(const uint64_t key) const {
+  // Fibonacci hashing spreads neighbouring encodings across the table. Only
+  // the top bits of the product depend on every bit of the key, so rotate
+  // them down to index the table.
+  const uint64_t hash = key * 0x9E3779B97F4A7C15u;
+  return std::rotl(hash, std::countr_zero(CAPACITY)) & (CAPACITY - 1);
+}
+
+/**
+ * Lookup - appends the cached text of an encoding.
+ *
+ * @param decoded - decoded instruction
+ * @param amode - current addressing mode
+ * @param len - set to the instruction length on a hit
+ * @param result - tokens to append to on a hit
+ * @return true on a hit
+ */
+bool TextCache::Lookup(const DecodedInstruction& decoded,
+                       const AddressMode amode, size_t& len,
+                       std::vector<BN::InstructionTextToken>& result) {
+  const uint64_t key = Key(decoded, amode);
+  const size_t slot = Slot(key);
+  const auto& entries = GetEntries();
+  {
+    std::lock_guard lock(MUTEXES[slot % STRIPES]);
+    const auto& entry = entries[slot];
+    if (entry.valid && entry.key == key) {
+      result.insert(result.end(), entry.tokens.begin(), entry.tokens.end());
+      len = entry.len;
+      HITS.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  MISSES.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+/**
+ * IsPinned - checks whether an instruction is listed in HOT_INSTRUCTIONS.
+ *
+ * @param id - instruction id
+ * @return true if its entries are kept over those of colder instructions
+ */
+bool TextCache::IsPinned(const uint16_t id) { return PINNED[id]; }
+
+/**
+ * Insert - caches the text of an encoding, replacing the slot's entry unless
+ * that entry is pinned (see IsPinned) and the new one is not. Pinned entries
+ * only give way to other pinned entries, so collisions with colder encodings
+ * cannot evict the hottest lines of disassembly.
+ *
+ * @param decoded - decoded instruction
+ * @param amode - current addressing mode
+ * @param len - instruction length reported by Text
+ * @param tokens - tokens Text rendered for the instruction
+ */
+void TextCache::Insert(const DecodedInstruction& decoded,
+                       const AddressMode amode, const size_t len,
+                       const std::span<const BN::InstructionTextToken> tokens) {
+  const uint64_t key = Key(decoded, amode);
+  const size_t slot = Slot(key);
+  auto& entries = GetEntries();
+  std::lock_guard lock(MUTEXES[slot % STRIPES]);
+  auto& entry = entries[slot];
+  if (!entry.valid) {
+    SIZE.fetch_add(1, std::memory_order_relaxed);
+  } else if (entry.key != key && IsPinned(entry.key >> 32 & 0xFFFF) &&
+             !IsPinned(decoded.id)) {
+    return;
+  }
+  entry.key = key;
+  entry.tokens.assign(tokens.begin(), tokens.end());
+  entry.len = static_cast<uint8_t>(len);
+  entry.valid = true;
+}
+
+/**
+ * Clear - drops every entry and resets the statistics.
+ */
+void TextCache::Clear() {
+  auto& entries = GetEntries();
+  for (size_t slot = 0; slot < entries.size(); slot++) {
+    std::lock_guard lock(MUTEXES[slot % STRIPES]);
+    entries[slot].valid = false;
+    entries[slot].tokens = {};
+  }
+  HITS = 0;
+  MISSES = 0;
+  SIZE = 0;
+}
+
+/**
+ * GetStats - returns the hit and miss counts since the cache was created or
+ * last cleared, and how full it is.
+ *
+ * @return cache statistics
+ */
+TextCache::Stats TextCache::GetStats() const {
+  return Stats{.hits = HITS.load(std::memory_order_relaxed),
+               .misses = MISSES.load(std::memory_order_relaxed),
+               .size = SIZE.load(std::memory_order_relaxed),
+               .capacity = CAPACITY};
+}
+
+/**
+ * Insert - adds an address that an RPT repeats.
+ *
+ * @param addr - address of the repeated instruction
+ */
+void RepeatSet::Insert(const uint64_t addr) {
+  auto& shard = SHARDS[ShardOf(addr)];
+  std::lock_guard lock(shard.mutex);
+  shard.addrs.insert(addr);
+}
+
+/**
+ * Contains - checks whether an address follows an RPT.
+ *
+ * @param addr - address of the instruction
+ * @return true if the address is in the set
+ */
+bool RepeatSet::Contains(const uint64_t addr) const {
+  const auto& shard = SHARDS[ShardOf(addr)];
+  std::lock_guard lock(shard.mutex);
+  return shard.addrs.contains(addr);
+}
+
+/**
+ * Clear - drops every address and frees the memory they used.
+ */
+void RepeatSet::Clear() {
+  for (auto& shard : SHARDS) {
+    std::lock_guard lock(shard.mutex);
+    shard.addrs = {};
+  }
+}
+
+/**
+ * Size - counts the addresses in the set.
+ *
+ * @return number of addresses
+ */
+size_t RepeatSet::Size() const {
+  size_t size = 0;
+  for (const auto& shard : SHARDS) {
+    std::lock_guard lock(shard.mutex);
+    size += shard.addrs.size();
+  }
+  return size;
+}
+}  // namespace TIC28X
@@ -0,0 +1,128 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_CACHE_H
+#define TIC28X_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include "architecture.h"
+
+namespace TIC28X {
+/**
+ * TextCache - bounded, thread-safe memo of rendered instruction text.
+ *
+ * The text of most instructions depends only on the instruction word and the
+ * address mode, and firmware repeats the same encodings constantly (MOVL
+ * XAR4,*SP++, LRETR, NOP, ...). Only instructions that are address
+ * independent (see Registry::ADDRESS_INDEPENDENT) may be cached.
+ *
+ * The table is direct mapped on a hash of the encoding, so memory is capped
+ * by the number of entries chosen at construction; a new encoding replaces
+ * whatever shared its slot, unless that is one of the hot instructions the
+ * build pins (see hot_instructions.h). The table is only allocated once the
+ * cache is first used.
+ */
+class TextCache {
+ public:
+  static constexpr size_t DEFAULT_CAPACITY = 1 << 12;  // entries
+  static constexpr size_t STRIPES = 64;                // mutexes
+
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    size_t size;      // entries in use
+    size_t capacity;  // entries
+  };
+
+  explicit TextCache(size_t capacity = DEFAULT_CAPACITY);
+
+  static bool IsPinned(uint16_t id);
+
+  bool Lookup(const DecodedInstruction& decoded, AddressMode amode,
+              size_t& len, std::vector<BN::InstructionTextToken>& result);
+  void Insert(const DecodedInstruction& decoded, AddressMode amode, size_t len,
+              std::span<const BN::InstructionTextToken> tokens);
+  void Clear();
+  [[nodiscard]] Stats GetStats() const;
+
+ private:
+  struct Entry {
+    uint64_t key;
+    std::vector<BN::InstructionTextToken> tokens;
+    uint8_t len;
+    bool valid;
+  };
+
+  static uint64_t Key(const DecodedInstruction& decoded, AddressMode amode);
+  [[nodiscard]] size_t Slot(uint64_t key) const;
+  std::vector<Entry>& GetEntries();
+
+  // ENTRIES is allocated on first use, so an idle cache costs no memory
+  size_t CAPACITY;
+  std::once_flag ENTRIES_ONCE;
+  std::vector<Entry> ENTRIES;
+  std::array<std::mutex, STRIPES> MUTEXES;
+  std::atomic<uint64_t> HITS = 0;
+  std::atomic<uint64_t> MISSES = 0;
+  std::atomic<size_t> SIZE = 0;
+};
+
+/**
+ * RepeatSet - exact, thread-safe set of the addresses an RPT instruction
+ * repeats.
+ *
+ * Info adds the address after every RPT it sees and Text checks whether a
+ * repeatable instruction follows one, from every analysis thread at once. The
+ * set is split into shards by address, each behind its own mutex, so threads
+ * working on different code rarely contend. Unlike the caches nothing is ever
+ * evicted, since a lost address would lose its "|| " prefix; the set is
+ * cleared instead when the last view using the architecture closes (see
+ * OpenViews).
+ *
+ * There is one set per architecture, shared by every open view of it: the
+ * architecture callbacks are not told which view they serve, so the addresses
+ * cannot be keyed by view. Two views of the same architecture open at once
+ * can therefore see each other's addresses, which at worst puts a stray
+ * "|| " on an instruction at an address the other view repeats. That is
+ * accepted because it only affects the text, never decoding or lifting, and
+ * such views are rare.
+ *
+ * The set is exact and must grow with the code, which a fixed size lock-free
+ * table cannot do without losing addresses, and a growable lock-free hash set
+ * is not worth its complexity here: only RPT and repeatable instructions
+ * touch the set, so with 64 shards a lock is almost never contended.
+ */
+class RepeatSet {
+ public:
+  static constexpr size_t STRIPES = 64;  // shards
+
+  void Insert(uint64_t addr);
+  [[nodiscard]] bool Contains(uint64_t addr) const;
+  void Clear();
+  [[nodiscard]] size_t Size() const;
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    std::unordered_set<uint64_t> addrs;
+  };
+
+  // Instructions are halfword aligned, so neighbours land in neighbouring
+  // shards
+  static size_t ShardOf(const uint64_t addr) {
+    return addr >> 1 & (STRIPES - 1);
+  }
+
+  std::array<Shard, STRIPES> SHARDS;
+};
+}  // namespace TIC28X
+
+#endif  // TIC28X_CACHE_H
@@ -0,0 +1,329 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "cache.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "conditions.h"
+#include "decoder.h"
+#include "hot_instructions.h"
+#include "instructions.h"
+#include "registry.h"
+
+// Opcode data for LB const22, a 32-bit branch
+static std::array<uint8_t, 4> lb_data(const uint32_t const22) {
+  const uint32_t op = TIC28X::LbConst22::SetConst22(const22);
+  return {
+      static_cast<uint8_t>(op >> 16 & 0xFF),
+      static_cast<uint8_t>(op >> 24),
+      static_cast<uint8_t>(op & 0xFF),
+      static_cast<uint8_t>(op >> 8 & 0xFF),
+  };
+}
+
+// Verify that text is keyed on the encoding and address mode
+TEST(TestTextCache, HitsMissesAndKeys) {
+  const auto cache = std::make_unique<TIC28X::TextCache>(3);
+  const auto& table = TIC28X::GetDecodeTable(TIC28X::OBJMODE_1);
+  const auto data = lb_data(0x3F1234);
+  const auto other = lb_data(0x3F0000);
+  const auto decoded = TIC28X::Decode(data.data(), 0x100, table);
+  const auto decoded_other = TIC28X::Decode(other.data(), 0x100, table);
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_TRUE(decoded_other.has_value());
+  EXPECT_EQ(4, cache->GetStats().capacity);
+
+  size_t len = 0;
+  std::vector<BN::InstructionTextToken> tokens;
+  EXPECT_FALSE(cache->Lookup(*decoded, TIC28X::AMODE_0, len, tokens));
+  const std::vector<BN::InstructionTextToken> text = {
+      {InstructionToken, "lb"}, {TextToken, " "}};
+  cache->Insert(*decoded, TIC28X::AMODE_0, 4, text);
+
+  ASSERT_TRUE(cache->Lookup(*decoded, TIC28X::AMODE_0, len, tokens));
+  EXPECT_EQ(4, len);
+  ASSERT_EQ(2, tokens.size());
+  EXPECT_EQ("lb", tokens[0].text);
+  EXPECT_FALSE(cache->Lookup(*decoded, TIC28X::AMODE_1, len, tokens));
+  EXPECT_FALSE(cache->Lookup(*decoded_other, TIC28X::AMODE_0, len, tokens));
+
+  const auto stats = cache->GetStats();
+  EXPECT_EQ(1, stats.hits);
+  EXPECT_EQ(3, stats.misses);
+  EXPECT_EQ(1, stats.size);
+
+  cache->Clear();
+  EXPECT_EQ(0, cache->GetStats().size);
+  EXPECT_FALSE(cache->Lookup(*decoded, TIC28X::AMODE_0, len, tokens));
+}
+
+// Verify that the architecture only memoizes address independent text
+TEST(TestTextCache, ArchitectureCallbacks) {
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1);
+  const auto lb = lb_data(0x3F1234);
+  const uint16_t sb = TIC28X::SbOff8Cond::SetOff8(0x10) |
+                      TIC28X::SbOff8Cond::SetCond(TIC28X::Conditions::UNC);
+  const std::array<uint8_t, 2> sb_data = {static_cast<uint8_t>(sb & 0xFF),
+                                          static_cast<uint8_t>(sb >> 8)};
+
+  std::vector<std::vector<BN::InstructionTextToken>> texts;
+  for (const uint64_t addr : {0x100, 0x200}) {
+    size_t len = 0;
+    texts.emplace_back();
+    ASSERT_TRUE(arch->GetInstructionText(lb.data(), addr, len, texts.back()));
+    EXPECT_EQ(4, len);
+    std::vector<BN::InstructionTextToken> tokens;
+    ASSERT_TRUE(arch->GetInstructionText(sb_data.data(), addr, len, tokens));
+    EXPECT_EQ(2, len);
+  }
+  ASSERT_EQ(texts[0].size(), texts[1].size());
+  for (size_t i = 0; i < texts[0].size(); i++) {
+    EXPECT_EQ(texts[0][i].text, texts[1][i].text);
+  }
+  EXPECT_EQ(1, arch->GetTextCacheHits());
+  EXPECT_EQ(1, arch->GetTextCacheMisses());
+
+  const auto uncached = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1, TIC28X::AMODE_0, 0);
+  size_t len = 0;
+  std::vector<BN::InstructionTextToken> tokens;
+  ASSERT_TRUE(uncached->GetInstructionText(lb.data(), 0x100, len, tokens));
+  EXPECT_EQ(0, uncached->GetTextCacheHits() + uncached->GetTextCacheMisses());
+}
+
+// Verify that the set is exact: addresses that share a shard are all kept
+// until it is cleared
+TEST(TestRepeatSet, InsertContainsAndClear) {
+  const auto set = std::make_unique<TIC28X::RepeatSet>();
+  EXPECT_FALSE(set->Contains(0));
+  EXPECT_FALSE(set->Contains(0x102));
+
+  set->Insert(0x102);
+  EXPECT_TRUE(set->Contains(0x102));
+  EXPECT_FALSE(set->Contains(0x104));
+
+  // 32KB apart, so all in the same shard
+  constexpr uint64_t stride = 0x8000;
+  for (uint64_t i = 1; i < 16; i++) {
+    set->Insert(0x102 + i * stride);
+  }
+  for (uint64_t i = 0; i < 16; i++) {
+    EXPECT_TRUE(set->Contains(0x102 + i * stride));
+  }
+  EXPECT_EQ(set->Size(), 16u);
+
+  set->Clear();
+  EXPECT_FALSE(set->Contains(0x102));
+  EXPECT_EQ(set->Size(), 0u);
+}
+
+// Verify that repeated instructions 32KB apart both keep their prefix, and
+// lose it once the repeat addresses are cleared
+TEST(TestRepeatSet, CollidingAddresses) {
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1);
+  const uint16_t rpt = TIC28X::RptConst8::SetConst8(5);
+  const uint16_t nop = TIC28X::NopIndArpn::SetInd(0xB8);  // NOP *
+  const std::array<uint8_t, 2> rpt_data = {static_cast<uint8_t>(rpt & 0xFF),
+                                           static_cast<uint8_t>(rpt >> 8)};
+  const std::array<uint8_t, 2> nop_data = {static_cast<uint8_t>(nop & 0xFF),
+                                           static_cast<uint8_t>(nop >> 8)};
+  const auto text = [&](const uint64_t addr) {
+    size_t len = 0;
+    std::vector<BN::InstructionTextToken> tokens;
+    EXPECT_TRUE(arch->GetInstructionText(nop_data.data(), addr, len, tokens));
+    return tokens.empty() ? std::string() : tokens[0].text;
+  };
+
+  constexpr std::array<uint64_t, 2> rpts = {0x100, 0x100 + 0x8000};
+  for (const auto addr : rpts) {
+    BN::InstructionInfo info;
+    ASSERT_TRUE(arch->GetInstructionInfo(rpt_data.data(), addr, 2, info));
+  }
+  for (const auto addr : rpts) {
+    EXPECT_EQ("|| ", text(addr + 2));
+  }
+
+  arch->ClearRepeatAddrs();
+  for (const auto addr : rpts) {
+    EXPECT_FALSE(arch->IsRepeatAddr(addr + 2));
+    EXPECT_NE("|| ", text(addr + 2));
+  }
+}
+
+// Verify that RPT info marks the next instruction as repeated, from many
+// threads at once
+TEST(TestRepeatSet, ArchitectureCallbacks) {
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1);
+  const uint16_t rpt = TIC28X::RptConst8::SetConst8(5);
+  const uint16_t nop = TIC28X::NopIndArpn::SetInd(0xB8);  // NOP *
+  const std::array<uint8_t, 2> rpt_data = {static_cast<uint8_t>(rpt & 0xFF),
+                                           static_cast<uint8_t>(rpt >> 8)};
+  const std::array<uint8_t, 2> nop_data = {static_cast<uint8_t>(nop & 0xFF),
+                                           static_cast<uint8_t>(nop >> 8)};
+
+  std::vector<std::thread> threads;
+  for (uint64_t t = 0; t < 4; t++) {
+    threads.emplace_back([&, t] {
+      for (uint64_t addr = t * 0x1000; addr < (t + 1) * 0x1000; addr += 8) {
+        BN::InstructionInfo info;
+        ASSERT_TRUE(arch->GetInstructionInfo(rpt_data.data(), addr, 2, info));
+        EXPECT_TRUE(arch->IsRepeatAddr(addr + 2));
+        EXPECT_FALSE(arch->IsRepeatAddr(addr + 4));
+
+        size_t len = 0;
+        std::vector<BN::InstructionTextToken> tokens;
+        ASSERT_TRUE(
+            arch->GetInstructionText(nop_data.data(), addr + 2, len, tokens));
+        ASSERT_FALSE(tokens.empty());
+        EXPECT_EQ("|| ", tokens[0].text);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Verify that with a byte reader the repeat prefix needs an address RPT Info
+// recorded, and is only dropped when the halfwords before the instruction are
+// certainly not an RPT
+TEST(TestRepeatSet, LookBehind) {
+  const uint16_t rpt = TIC28X::RptLoc16::SetLoc16(0xA8);  // RPT @AH
+  const uint16_t nop = TIC28X::NopIndArpn::SetInd(0xB8);  // NOP *
+  const auto lb = lb_data(rpt);                           // LSW looks like RPT
+  // NOP * at 0x100 (repeated), 0x102 (not repeated) and 0x108 (after an LB
+  // whose LSW looks like an RPT)
+  const std::array<uint8_t, 14> view = {
+      static_cast<uint8_t>(nop & 0xFF), static_cast<uint8_t>(nop >> 8),
+      static_cast<uint8_t>(rpt & 0xFF), static_cast<uint8_t>(rpt >> 8),
+      static_cast<uint8_t>(nop & 0xFF), static_cast<uint8_t>(nop >> 8),
+      static_cast<uint8_t>(nop & 0xFF), static_cast<uint8_t>(nop >> 8),
+      lb[0], lb[1], lb[2], lb[3],
+      static_cast<uint8_t>(nop & 0xFF), static_cast<uint8_t>(nop >> 8)};
+  constexpr uint64_t base = 0xFC;
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1, TIC28X::AMODE_0,
+      TIC28X::TIC28XArchitecture::TEXT_CACHE_ENTRIES,
+      [&view](const TIC28X::TIC28XArchitecture&, const uint64_t addr,
+              uint8_t* data, const size_t len) {
+        if (addr < base || addr - base + len > view.size()) {
+          return false;
+        }
+        std::copy_n(view.data() + (addr - base), len, data);
+        return true;
+      });
+  const auto is_prefixed = [&](const uint64_t addr) {
+    size_t len = 0;
+    std::vector<BN::InstructionTextToken> tokens;
+    EXPECT_TRUE(arch->GetInstructionText(view.data() + (addr - base), addr,
+                                         len, tokens));
+    return !tokens.empty() && tokens[0].text == "|| ";
+  };
+
+  // The bytes before 0x100 are an RPT, but Info has not seen it yet
+  EXPECT_EQ(arch->LookBehind(0x100), true);
+  EXPECT_FALSE(is_prefixed(0x100));
+  BN::InstructionInfo info;
+  ASSERT_TRUE(arch->GetInstructionInfo(view.data() + 2, base + 2, 2, info));
+  EXPECT_TRUE(arch->IsRepeatAddr(0x100));
+
+  // RPT Info for 0x102 is stale: the bytes before it are no longer an RPT
+  arch->AddRepeatAddr(0x102);
+  for (const auto& [addr, repeated] :
+       {std::pair{0x100, true}, std::pair{0x102, false}}) {
+    EXPECT_EQ(repeated, is_prefixed(addr)) << std::hex << addr;
+    EXPECT_EQ(repeated, arch->IsRepeated(addr)) << std::hex << addr;
+  }
+
+  // The LB's LSW is ambiguous, so it only repeats 0x108 once control flow
+  // reaches it as an RPT
+  EXPECT_EQ(arch->LookBehind(0x108), std::nullopt);
+  EXPECT_FALSE(is_prefixed(0x108));
+  ASSERT_TRUE(arch->GetInstructionInfo(view.data() + 10, 0x106, 2, info));
+  EXPECT_TRUE(arch->IsRepeatAddr(0x108));
+  EXPECT_TRUE(is_prefixed(0x108));
+
+  // Bytes the reader cannot reach keep what RPT Info recorded
+  EXPECT_FALSE(arch->IsRepeated(0x40));
+  arch->AddRepeatAddr(0x40);
+  EXPECT_TRUE(arch->IsRepeated(0x40));
+}
+
+// Verify that architectures sharing a text cache reuse each other's text, but
+// never across address modes
+TEST(TestTextCache, SharedBetweenArchitectures) {
+  const auto cache = std::make_shared<TIC28X::TextCache>();
+  const auto c27x = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_0, TIC28X::AMODE_0, cache);
+  const auto c28x = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1, TIC28X::AMODE_0, cache);
+  const auto c2xlp = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1, TIC28X::AMODE_1, cache);
+  const auto lb = lb_data(0x3F1234);
+
+  for (const auto& arch : {c27x.get(), c28x.get(), c2xlp.get()}) {
+    size_t len = 0;
+    std::vector<BN::InstructionTextToken> tokens;
+    ASSERT_TRUE(arch->GetInstructionText(lb.data(), 0x100, len, tokens));
+    EXPECT_EQ(4, len);
+  }
+  EXPECT_EQ(1, cache->GetStats().hits);
+  EXPECT_EQ(2, cache->GetStats().misses);
+  EXPECT_EQ(2, cache->GetStats().size);
+  EXPECT_EQ(c27x->GetTextCacheHits(), c2xlp->GetTextCacheHits());
+}
+
+// Verify that entries of HOT_INSTRUCTIONS are only replaced by other pinned
+// entries
+TEST(TestTextCache, PinnedEntries) {
+  using TIC28X::Registry;
+  size_t pinned = 0;
+  for (uint16_t id = 0; id < Registry::COUNT; id++) {
+    pinned += TIC28X::TextCache::IsPinned(id);
+  }
+  EXPECT_EQ(pinned, TIC28X::HOT_INSTRUCTIONS.size());
+
+  // A single entry, so every encoding collides
+  const auto cache = std::make_unique<TIC28X::TextCache>(1);
+  const TIC28X::DecodedInstruction movl = {
+      .word = TIC28X::MovlXar4Loc32::SetLoc32(0xBD),
+      .id = Registry::ID<TIC28X::MovlXar4Loc32>,
+      .length = 2};
+  const TIC28X::DecodedInstruction nop = {
+      .word = TIC28X::NopIndArpn::SetInd(0xB8),
+      .id = Registry::ID<TIC28X::NopIndArpn>,
+      .length = 2};
+  const TIC28X::DecodedInstruction lretr = {
+      .word = TIC28X::Lretr::opcode,
+      .id = Registry::ID<TIC28X::Lretr>,
+      .length = 2};
+  ASSERT_TRUE(TIC28X::TextCache::IsPinned(movl.id));
+  ASSERT_FALSE(TIC28X::TextCache::IsPinned(nop.id));
+  ASSERT_TRUE(TIC28X::TextCache::IsPinned(lretr.id));
+
+  size_t len = 0;
+  std::vector<BN::InstructionTextToken> tokens;
+  const std::vector<BN::InstructionTextToken> text = {{TextToken, "x"}};
+  cache->Insert(movl, TIC28X::AMODE_0, 2, text);
+  cache->Insert(nop, TIC28X::AMODE_0, 2, text);
+  EXPECT_TRUE(cache->Lookup(movl, TIC28X::AMODE_0, len, tokens));
+  EXPECT_FALSE(cache->Lookup(nop, TIC28X::AMODE_0, len, tokens));
+
+  cache->Insert(lretr, TIC28X::AMODE_0, 2, text);
+  EXPECT_TRUE(cache->Lookup(lretr, TIC28X::AMODE_0, len, tokens));
+  EXPECT_FALSE(cache->Lookup(movl, TIC28X::AMODE_0, len, tokens));
+  EXPECT_EQ(1, cache->GetStats().size);
+}
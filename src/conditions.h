@@ -3,9 +3,9 @@
 
 #ifndef TIC28X_CONDITIONS_H
 #define TIC28X_CONDITIONS_H
+
+#include <array>
 #include <cstdint>
-#include <string>
-#include <unordered_map>
 
 namespace TIC28X::Conditions {
 constexpr uint8_t NEQ = 0x0;
@@ -25,11 +25,10 @@ constexpr uint8_t TC = 0xD;
 constexpr uint8_t NBIO = 0xE;
 constexpr uint8_t UNC = 0xF;
 
-inline std::unordered_map<uint8_t, std::string> NAMES = {
-    {NEQ, "neq"},      {EQ, "eq"},   {GT, "gt"},     {GEQ, "geq"},
-    {LT, "lt"},        {LEQ, "leq"}, {HI, "hi"},     {HIS_C, "his, c"},
-    {LO_NC, "lo, nc"}, {LOS, "los"}, {NOV, "nov"},   {OV, "ov"},
-    {NTC, "ntc"},      {TC, "tc"},   {NBIO, "nbio"}, {UNC, "unc"},
+// Condition names, indexed by condition code
+inline constexpr std::array<const char*, 16> NAMES = {
+    "neq", "eq", "gt", "geq", "lt", "leq", "hi", "his, c", "lo, nc", "los",
+    "nov", "ov", "ntc", "tc", "nbio", "unc",
 };
 
 }  // namespace TIC28X::Conditions
@@ -0,0 +1,176 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+/**
+ * decode_check - proves that the compile-time decode tables agree with the
+ * Registry's list order, and reports every pair of overlapping encodings.
+ *
+ * For each object mode, every possible first halfword is resolved the slow
+ * way (first 16-bit match in list order, otherwise the list-ordered 32-bit
+ * candidates whose MSW matches) and compared with the fast table entry. Since
+ * the second level only ever depends on the candidates chained for an MSW,
+ * this covers the whole MSW-qualified 32-bit space as well.
+ *
+ * Usage: tic28x_decode_check [output directory]
+ * If an output directory is given, the priority-resolved decode table for
+ * each object mode is written to decode_table_objmode_<n>.txt.
+ *
+ * Exits non-zero if any table entry disagrees with the list order.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "decoder.h"
+#include "registry.h"
+
+namespace {
+using TIC28X::DecodeTable;
+using TIC28X::ObjectMode;
+using TIC28X::Registry;
+
+bool IsValidIn(const size_t i, const ObjectMode objmode) {
+  return Registry::OBJMODES[i] == TIC28X::OBJMODE_ANY ||
+         Registry::OBJMODES[i] == objmode;
+}
+
+// Do two encodings of the same length share at least one opcode?
+bool Overlaps(const size_t a, const size_t b) {
+  return Registry::LENGTHS[a] == Registry::LENGTHS[b] &&
+         ((Registry::OPCODES[a] ^ Registry::OPCODES[b]) &
+          Registry::OPCODE_MASKS[a] & Registry::OPCODE_MASKS[b]) == 0;
+}
+
+// Does encoding a cover every opcode of encoding b?
+bool Covers(const size_t a, const size_t b) {
+  return (Registry::OPCODE_MASKS[a] & ~Registry::OPCODE_MASKS[b]) == 0 &&
+         (Registry::OPCODES[b] & Registry::OPCODE_MASKS[a]) ==
+             Registry::OPCODES[a];
+}
+
+// Report pairs of overlapping encodings; the first of each pair wins
+void ReportOverlaps(const ObjectMode objmode) {
+  for (size_t a = 0; a < Registry::COUNT; a++) {
+    if (!IsValidIn(a, objmode)) {
+      continue;
+    }
+    for (size_t b = a + 1; b < Registry::COUNT; b++) {
+      if (IsValidIn(b, objmode) && Overlaps(a, b)) {
+        std::printf("objmode %d: %s (0x%x/0x%x) shadows %s (0x%x/0x%x)%s\n",
+                    objmode, Registry::FULL_NAMES[a], Registry::OPCODES[a],
+                    Registry::OPCODE_MASKS[a], Registry::FULL_NAMES[b],
+                    Registry::OPCODES[b], Registry::OPCODE_MASKS[b],
+                    Covers(a, b) ? " [unreachable]" : "");
+      }
+    }
+  }
+}
+
+// Resolve a halfword by list order into the ids the table should hold: a
+// single id if the halfword decides the instruction, otherwise the ordered
+// 32-bit candidates that need the LSW checked
+std::vector<uint16_t> Resolve(const uint32_t msw, const ObjectMode objmode) {
+  for (size_t i = 0; i < Registry::COUNT; i++) {
+    if (IsValidIn(i, objmode) &&
+        Registry::LENGTHS[i] == TIC28X::Sizes::_2_BYTES &&
+        (msw & Registry::OPCODE_MASKS[i]) == Registry::OPCODES[i]) {
+      return {static_cast<uint16_t>(i)};
+    }
+  }
+
+  std::vector<uint16_t> candidates;
+  for (size_t i = 0; i < Registry::COUNT; i++) {
+    const uint32_t opcode = Registry::OPCODES[i];
+    const uint32_t mask = Registry::OPCODE_MASKS[i];
+    if (IsValidIn(i, objmode) &&
+        Registry::LENGTHS[i] == TIC28X::Sizes::_4_BYTES &&
+        (opcode & mask) == opcode && (msw & mask >> 16) == opcode >> 16) {
+      candidates.push_back(static_cast<uint16_t>(i));
+      if ((mask & 0xFFFFu) == 0) {
+        break;  // later candidates are unreachable
+      }
+    }
+  }
+  return candidates;
+}
+
+// Read a table entry back as the list of ids it stands for
+std::vector<uint16_t> Entry(const DecodeTable& table, const uint32_t msw) {
+  const uint16_t entry = table.Lookup16(msw);
+  if (entry == DecodeTable::INVALID) {
+    return {};
+  }
+  if (entry < DecodeTable::CHAIN) {
+    return {entry};
+  }
+  std::vector<uint16_t> chain;
+  for (uint16_t node = entry & ~DecodeTable::CHAIN;
+       node != DecodeTable::INVALID; node = table.GetNode(node).next) {
+    chain.push_back(table.GetNode(node).index);
+  }
+  return chain;
+}
+
+std::string EntryText(const std::vector<uint16_t>& ids) {
+  if (ids.empty()) {
+    return "invalid";
+  }
+  std::string text;
+  for (const auto id : ids) {
+    if (!text.empty()) {
+      text += ", ";
+    }
+    text += Registry::FULL_NAMES[id];
+  }
+  return text;
+}
+
+// Compare every table entry with the list order and optionally dump the table
+size_t CheckTable(const ObjectMode objmode, std::FILE* out) {
+  const auto& table = TIC28X::GetDecodeTable(objmode);
+  size_t mismatches = 0;
+
+  for (uint32_t msw = 0; msw <= 0xFFFF; msw++) {
+    const auto want = Resolve(msw, objmode);
+    const auto got = Entry(table, msw);
+    if (want != got) {
+      std::printf("objmode %d: MISMATCH at 0x%04x: table [%s], list [%s]\n",
+                  objmode, msw, EntryText(got).c_str(),
+                  EntryText(want).c_str());
+      mismatches++;
+    }
+    if (out) {
+      std::fprintf(out, "0x%04x %s\n", msw, EntryText(got).c_str());
+    }
+  }
+  return mismatches;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  size_t mismatches = 0;
+
+  for (const auto objmode :
+       {TIC28X::OBJMODE_0, TIC28X::OBJMODE_1, TIC28X::OBJMODE_ANY}) {
+    ReportOverlaps(objmode);
+
+    std::FILE* out = nullptr;
+    if (argc > 1) {
+      const auto path = std::string(argv[1]) + "/decode_table_objmode_" +
+                        std::to_string(objmode) + ".txt";
+      out = std::fopen(path.c_str(), "w");
+      if (!out) {
+        std::printf("could not open %s\n", path.c_str());
+        return 1;
+      }
+    }
+    mismatches += CheckTable(objmode, out);
+    if (out) {
+      std::fclose(out);
+    }
+  }
+
+  std::printf("%zu decode table mismatches\n", mismatches);
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,334 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "decoder.h"
+
+#include <binaryninjaapi.h>
+
+#include "bulk.h"
+#include "instrumentation.h"
+#include "util.h"
+
+namespace TIC28X {
+/**
+ * AddNode - appends a node for an instruction to the node array.
+ *
+ * @param index - instruction id (see Registry)
+ * @param next - next node in the chain, or INVALID
+ * @return the new node's number
+ */
+constexpr uint16_t DecodeTable::AddNode(const size_t index,
+                                        const uint16_t next) {
+  NODES[NODE_COUNT] =
+      DecodeNode{.opcode = Registry::OPCODES[index],
+                 .opcode_mask = Registry::OPCODE_MASKS[index],
+                 .index = static_cast<uint16_t>(index),
+                 .next = next};
+  return NODE_COUNT++;
+}
+
+/**
+ * DecodeTable - builds the two-level decode table for an object mode. This
+ * only runs at compile time.
+ *
+ * Each instruction covers every MSW that matches its opcode under its opcode
+ * mask. The Registry is walked in reverse so that earlier instructions
+ * overwrite (or are chained in front of) later ones, which gives the same
+ * first-match priority as the linear scan. 32-bit instructions are placed
+ * first so that 16-bit instructions, which the linear scan always tries
+ * first, overwrite them.
+ *
+ * @param objmode - object mode the table is built for
+ */
+constexpr DecodeTable::DecodeTable(const ObjectMode objmode)
+    : OBJMODE(objmode), TABLE(), NODES(), NODE_COUNT(0) {
+  TABLE.fill(INVALID);
+
+  for (const size_t length : {Sizes::_4_BYTES, Sizes::_2_BYTES}) {
+    for (size_t i = Registry::COUNT; i-- > 0;) {
+      const auto inst_objmode = Registry::OBJMODES[i];
+      if (Registry::LENGTHS[i] != length ||
+          (inst_objmode != OBJMODE_ANY && inst_objmode != objmode)) {
+        continue;
+      }
+
+      const uint32_t opcode = Registry::OPCODES[i];
+      const uint32_t mask = Registry::OPCODE_MASKS[i];
+      if ((opcode & mask) != opcode) {
+        continue;  // can never match
+      }
+
+      const uint32_t msw_opcode = length == Sizes::_4_BYTES ? opcode >> 16
+                                                            : opcode;
+      const uint32_t msw_mask = length == Sizes::_4_BYTES ? mask >> 16 : mask;
+      const bool needs_lsw =
+          length == Sizes::_4_BYTES && (mask & 0xFFFFu) != 0;
+
+      // Enumerate every value of the don't-care bits
+      const uint32_t free_bits = ~msw_mask & 0xFFFFu;
+      uint32_t sub = 0;
+      do {
+        auto& entry = TABLE[msw_opcode | sub];
+        if (!needs_lsw) {
+          entry = static_cast<uint16_t>(i);
+        } else if (entry == INVALID) {
+          entry = CHAIN | AddNode(i, INVALID);
+        } else if (entry & CHAIN) {
+          entry = CHAIN | AddNode(i, entry & ~CHAIN);
+        } else {
+          entry = CHAIN | AddNode(i, AddNode(entry, INVALID));
+        }
+        sub = (sub - free_bits) & free_bits;
+      } while (sub != 0);
+    }
+  }
+}
+
+/**
+ * Lookup32 - second-level lookup of a 32-bit opcode in a node chain.
+ *
+ * @param node - first node of the chain, taken from a CHAIN entry
+ * @param op32 - full 32-bit opcode
+ * @return instruction id of the first match, or INVALID
+ */
+uint16_t DecodeTable::Lookup32(uint16_t node, const uint32_t op32) const {
+  [[maybe_unused]] size_t depth = 1;
+  while (node != INVALID) {
+    if ((op32 & NODES[node].opcode_mask) == NODES[node].opcode) {
+      TIC28X_DECODE_DEPTH(depth);
+      return NODES[node].index;
+    }
+    node = NODES[node].next;
+    depth++;
+  }
+  return INVALID;
+}
+
+/**
+ * LengthTable - builds the length table for a decode table's object mode.
+ * This only runs at compile time.
+ *
+ * @param table - decode table to take instruction lengths from
+ */
+constexpr LengthTable::LengthTable(const DecodeTable& table) : PACKED() {
+  for (uint32_t op16 = 0; op16 <= 0xFFFF; op16++) {
+    const auto entry = table.Lookup16(op16);
+    size_t length = 0;
+    if (entry < DecodeTable::CHAIN) {
+      length = Registry::LENGTHS[entry];
+    } else if (entry != DecodeTable::INVALID) {
+      length = Sizes::_4_BYTES;  // chains only hold 32-bit instructions
+    }
+    PACKED[op16 >> 2] |= (length / Sizes::_2_BYTES) << (op16 & 3) * 2;
+  }
+}
+
+namespace {
+// Indexed by ObjectMode
+constexpr DecodeTable DECODE_TABLES[] = {
+    DecodeTable(OBJMODE_0),
+    DecodeTable(OBJMODE_1),
+    DecodeTable(OBJMODE_ANY),
+};
+
+// Indexed by ObjectMode
+constexpr LengthTable LENGTH_TABLES[] = {
+    LengthTable(DECODE_TABLES[OBJMODE_0]),
+    LengthTable(DECODE_TABLES[OBJMODE_1]),
+    LengthTable(DECODE_TABLES[OBJMODE_ANY]),
+};
+}  // namespace
+
+/**
+ * GetDecodeTable - returns the compile-time decode table for an object mode.
+ *
+ * @param objmode - object mode
+ * @return decode table that only decodes instructions valid in objmode
+ */
+const DecodeTable& GetDecodeTable(const ObjectMode objmode) {
+  return DECODE_TABLES[objmode];
+}
+
+/**
+ * GetLengthTable - returns the compile-time length table for an object mode.
+ *
+ * @param objmode - object mode
+ * @return length table that only knows instructions valid in objmode
+ */
+const LengthTable& GetLengthTable(const ObjectMode objmode) {
+  return LENGTH_TABLES[objmode];
+}
+
+/**
+ * DecodeInstruction - table driven version of DecodeInstruction.
+ *
+ * Most instructions are resolved with a single table lookup on the first
+ * halfword. 32-bit instructions that define bits in the LSW are resolved by
+ * walking the short chain of candidates selected by the MSW.
+ *
+ * @param data - pointer to opcode data from binary ninja
+ * @param table - decode table for the current object mode
+ * @return either nullptr or a valid instruction
+ */
+Instruction* DecodeInstruction(const uint8_t* data, const DecodeTable& table) {
+  const uint16_t op16 = DataToOpcode(data, Sizes::_2_BYTES);
+  const auto entry = table.Lookup16(op16);
+  if (entry < DecodeTable::CHAIN) {
+    return Registry::INSTRUCTIONS[entry];
+  }
+
+  const uint32_t op32 = DataToOpcode(data, Sizes::_4_BYTES);
+  if (entry != DecodeTable::INVALID) {
+    const uint16_t index = table.Lookup32(entry & ~DecodeTable::CHAIN, op32);
+    if (index != DecodeTable::INVALID) {
+      return Registry::INSTRUCTIONS[index];
+    }
+  }
+  BN::LogDebug("invalid opcode: %x", op32);
+  return nullptr;
+}
+
+/**
+ * Decode - decodes an instruction into a DecodedInstruction, so that Info,
+ * Text and Lift can share a single decode.
+ *
+ * @param data - pointer to opcode data from binary ninja
+ * @param addr - address of the instruction, for its branch target
+ * @param table - decode table for the current object mode
+ * @return the decoded instruction, or std::nullopt if the opcode is invalid
+ */
+std::optional<DecodedInstruction> Decode(const uint8_t* data,
+                                         const uint64_t addr,
+                                         const DecodeTable& table) {
+  TIC28X_TIME(CALLBACK_DECODE);
+  const uint16_t op16 = DataToOpcode(data, Sizes::_2_BYTES);
+  uint16_t id = table.Lookup16(op16);
+  uint32_t op32 = 0;
+  if (id >= DecodeTable::CHAIN) {
+    op32 = DataToOpcode(data, Sizes::_4_BYTES);
+    if (id != DecodeTable::INVALID) {
+      id = table.Lookup32(id & ~DecodeTable::CHAIN, op32);
+    }
+    if (id == DecodeTable::INVALID) {
+      TIC28X_COUNT(EVENT_INVALID_OPCODE);
+      BN::LogDebug("invalid opcode: %x", op32);
+      return std::nullopt;
+    }
+  } else {
+    TIC28X_DECODE_DEPTH(0);
+    if (Registry::LENGTHS[id] == Sizes::_4_BYTES) {
+      op32 = DataToOpcode(data, Sizes::_4_BYTES);
+    }
+  }
+
+  const uint8_t length = Registry::LENGTHS[id];
+  const uint32_t word = length == Sizes::_4_BYTES ? op32 : op16;
+  const auto get_target = Registry::TARGETS[id];
+  return DecodedInstruction{
+      .target = get_target ? get_target(word, addr) : 0,
+      .word = word,
+      .id = id,
+      .length = length,
+      .branch = Registry::BRANCHES[id],
+  };
+}
+
+/**
+ * GetInstruction - returns the instruction singleton a decode resolved to.
+ *
+ * @param decoded - decoded instruction
+ * @return instruction that implements Info, Text and Lift for decoded
+ */
+Instruction* GetInstruction(const DecodedInstruction& decoded) {
+  return Registry::INSTRUCTIONS[decoded.id];
+}
+
+/**
+ * ExtractOperands - pulls every operand field out of a decoded instruction.
+ *
+ * Each field is a shift, a mask and (for signed fields) a sign extension by
+ * shifting, so the extraction is the same branch-free code for every
+ * instruction; only the field descriptors differ.
+ *
+ * @param decoded - decoded instruction
+ * @return operand values, sign extended where the field is signed
+ */
+Operands ExtractOperands(const DecodedInstruction& decoded) {
+  const auto fields = Registry::FIELDS[decoded.id];
+  Operands operands = {.values = {},
+                       .count = static_cast<uint8_t>(fields.size())};
+  for (size_t i = 0; i < fields.size(); i++) {
+    operands.values[i] = fields[i].Extract(decoded.word);
+  }
+  return operands;
+}
+
+/**
+ * IsRepeatPrefix - checks whether the halfword before an instruction is an
+ * RPT, which repeats the instruction that follows it. Both RPT forms are 16
+ * bits, so the halfword before an instruction is all it takes to decide
+ * whether it is repeated, as long as that halfword starts an instruction.
+ *
+ * It might instead be the LSW of a 32-bit instruction that happens to look
+ * like an RPT. That can only be the case if the halfword before it could
+ * start a 32-bit instruction; since that one might in turn be an LSW, only
+ * control flow can tell the two apart, and the answer is left open.
+ *
+ * @param data - pointer to the 4 bytes before an instruction
+ * @param table - decode table for the current object mode
+ * @return true if the halfword before the instruction is RPT #const8 or
+ * RPT loc16, false if it is not an RPT, or std::nullopt if it looks like an
+ * RPT but may be the LSW of a 32-bit instruction
+ */
+std::optional<bool> IsRepeatPrefix(const uint8_t* data,
+                                   const DecodeTable& table) {
+  static_assert(Registry::ID<RptConst8> < Registry::COUNT &&
+                Registry::ID<RptLoc16> < Registry::COUNT);
+  const uint16_t id =
+      table.Lookup16(DataToOpcode(data + Sizes::_2_BYTES, Sizes::_2_BYTES));
+  if (id != Registry::ID<RptConst8> && id != Registry::ID<RptLoc16>) {
+    return false;
+  }
+  // Chains only hold 32-bit instructions
+  const uint16_t prev = table.Lookup16(DataToOpcode(data, Sizes::_2_BYTES));
+  if (prev != DecodeTable::INVALID &&
+      (prev & DecodeTable::CHAIN ||
+       Registry::LENGTHS[prev] == Sizes::_4_BYTES)) {
+    return std::nullopt;
+  }
+  return true;
+}
+
+/**
+ * PredecodeLength - finds the length of an instruction without decoding it.
+ *
+ * @param data - pointer to at least 2 bytes of opcode data
+ * @param table - length table for the current object mode
+ * @return instruction length in bytes, or 0 if the opcode is invalid
+ */
+uint8_t PredecodeLength(const uint8_t* data, const LengthTable& table) {
+  return table.Lookup(DataToOpcode(data, Sizes::_2_BYTES));
+}
+
+/**
+ * PredecodeLengths - finds the length of an instruction starting at every
+ * halfword of a buffer. A linear sweep can then step through out by each
+ * length without touching the opcode data again.
+ *
+ * Uses the fastest bulk kernel this CPU supports (see bulk.h). A 32-bit
+ * instruction starting at the last halfword still reports 4, so callers must
+ * check that it fits.
+ *
+ * @param data - pointer to opcode data
+ * @param len - length of data in bytes; a trailing odd byte is ignored
+ * @param out - receives one length (0, 2 or 4) per halfword, len / 2 in total
+ * @param table - length table for the current object mode
+ * @return number of lengths written to out
+ */
+size_t PredecodeLengths(const uint8_t* data, const size_t len, uint8_t* out,
+                        const LengthTable& table) {
+  const size_t count = len / Sizes::_2_BYTES;
+  GetBulkKernels().lookup_lengths(data, count, table, out);
+  return count;
+}
+}  // namespace TIC28X
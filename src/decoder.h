@@ -0,0 +1,137 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_DECODER_H
+#define TIC28X_DECODER_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "architecture.h"
+#include "registry.h"
+
+namespace TIC28X {
+/**
+ * DecodeNode - a 32-bit instruction that needs its LSW checked before it can
+ * be accepted. Nodes form one chain per MSW, in decode priority order.
+ */
+struct DecodeNode {
+  uint32_t opcode;
+  uint32_t opcode_mask;
+  uint16_t index;  // instruction id (see Registry)
+  uint16_t next;   // next node in the chain, or DecodeTable::INVALID
+};
+
+/**
+ * DecodeTable - two-level decode table for a single object mode.
+ *
+ * The first level is indexed by the first 16-bit word of an instruction (which
+ * is also the MSW of a 32-bit instruction). Each entry is one of:
+ *  - an instruction id, when the MSW alone decides the instruction (every
+ *    16-bit instruction and most 32-bit instructions)
+ *  - CHAIN | n, when the LSW is needed; node n starts the chain of candidate
+ *    32-bit instructions for this MSW
+ *  - INVALID, if nothing can match this MSW
+ *
+ * Only instructions that define bits in the LSW (e.g. MASK_FFFFFF00,
+ * MASK_FFFEFF00) ever need the second level.
+ *
+ * The tables are generated from the Registry at compile time, in Registry
+ * order, so they always agree with the linear scan in DecodeInstruction.
+ */
+class DecodeTable {
+ public:
+  static constexpr uint16_t CHAIN = 0x8000;
+  static constexpr uint16_t INVALID = 0xFFFF;
+
+  // Upper bound on the nodes any object mode needs: one per MSW covered by an
+  // LSW-defining instruction, plus one MSW-only instruction ending each chain
+  static constexpr size_t NODE_CAPACITY = [] {
+    size_t count = 0;
+    for (size_t i = 0; i < Registry::COUNT; i++) {
+      if (Registry::LENGTHS[i] == Sizes::_4_BYTES &&
+          (Registry::OPCODE_MASKS[i] & 0xFFFFu) != 0) {
+        count += 2u << (16 - std::popcount(Registry::OPCODE_MASKS[i] >> 16));
+      }
+    }
+    return count;
+  }();
+  static_assert(NODE_CAPACITY < CHAIN, "decode nodes must fit in 15 bits");
+
+  constexpr explicit DecodeTable(ObjectMode objmode);
+
+  [[nodiscard]] constexpr ObjectMode GetObjmode() const { return OBJMODE; }
+  [[nodiscard]] constexpr uint16_t Lookup16(const uint16_t op16) const {
+    return TABLE[op16];
+  }
+  [[nodiscard]] uint16_t Lookup32(uint16_t node, uint32_t op32) const;
+  [[nodiscard]] const DecodeNode& GetNode(const uint16_t node) const {
+    return NODES[node];
+  }
+  // First-level entries, for bulk lookups (see bulk.h). NODES follows TABLE,
+  // so a 32-bit gather of the last entry stays inside the object.
+  [[nodiscard]] const uint16_t* GetEntries() const { return TABLE.data(); }
+
+ private:
+  constexpr uint16_t AddNode(size_t index, uint16_t next);
+
+  ObjectMode OBJMODE;
+  std::array<uint16_t, 0x10000> TABLE;
+  std::array<DecodeNode, NODE_CAPACITY> NODES;
+  uint16_t NODE_COUNT;
+};
+
+/**
+ * LengthTable - length-only predecode table for a single object mode.
+ *
+ * Maps the first 16-bit word of an instruction to its length in bytes: 2, 4,
+ * or 0 if nothing can start with that word. Lengths are packed four to a byte
+ * (0, 1 or 2 halfwords in each 2-bit field), so a table is only 16KB.
+ *
+ * When a 32-bit instruction needs its LSW checked the length is 4 even though
+ * a full decode may still reject the LSW.
+ */
+class LengthTable {
+ public:
+  constexpr explicit LengthTable(const DecodeTable& table);
+
+  [[nodiscard]] constexpr uint8_t Lookup(const uint16_t op16) const {
+    return (PACKED[op16 >> 2] >> (op16 & 3) * 2 & 3) * Sizes::_2_BYTES;
+  }
+  // Packed lengths, for bulk lookups (see bulk.h)
+  [[nodiscard]] const uint8_t* GetPacked() const { return PACKED.data(); }
+
+ private:
+  // 3 bytes of padding keep a 32-bit gather of the last byte in bounds
+  std::array<uint8_t, 0x10000 / 4 + 3> PACKED;
+};
+
+/**
+ * Operands - every operand field of a decoded instruction, in the order of
+ * the class's fields (see Registry::FIELDS for their kinds).
+ */
+struct Operands {
+  std::array<int32_t, MAX_FIELDS> values;
+  uint8_t count;
+};
+
+const DecodeTable& GetDecodeTable(ObjectMode objmode);
+const LengthTable& GetLengthTable(ObjectMode objmode);
+
+Instruction* DecodeInstruction(const uint8_t* data, const DecodeTable& table);
+std::optional<DecodedInstruction> Decode(const uint8_t* data, uint64_t addr,
+                                        const DecodeTable& table);
+Instruction* GetInstruction(const DecodedInstruction& decoded);
+Operands ExtractOperands(const DecodedInstruction& decoded);
+std::optional<bool> IsRepeatPrefix(const uint8_t* data,
+                                   const DecodeTable& table);
+
+uint8_t PredecodeLength(const uint8_t* data, const LengthTable& table);
+size_t PredecodeLengths(const uint8_t* data, size_t len, uint8_t* out,
+                        const LengthTable& table);
+}  // namespace TIC28X
+
+#endif  // TIC28X_DECODER_H
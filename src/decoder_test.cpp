@@ -0,0 +1,244 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "decoder.h"
+
+#include <binaryninjaapi.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <optional>
+
+#include "instructions.h"
+#include "registry.h"
+#include "test_util.h"
+#include "util.h"
+
+// Verify that the table driven decoder agrees with the linear decoder for
+// every possible first halfword
+class TestDecodeTable : public ::testing::TestWithParam<TIC28X::ObjectMode> {};
+
+TEST_P(TestDecodeTable, MatchesLinearDecoder) {
+  const TIC28X::ObjectMode objmode = GetParam();
+  const auto instructions = TIC28X::GetInstructions();
+  const auto& table = TIC28X::GetDecodeTable(objmode);
+
+  for (const uint16_t lsw : {0x0000, 0xFFFF}) {
+    for (uint32_t msw = 0; msw <= 0xFFFF; msw++) {
+      const std::array<uint8_t, 4> data = {
+          static_cast<uint8_t>(msw & 0xFF),
+          static_cast<uint8_t>(msw >> 8),
+          static_cast<uint8_t>(lsw & 0xFF),
+          static_cast<uint8_t>(lsw >> 8),
+      };
+
+      const auto want =
+          TIC28X::DecodeInstruction(data.data(), instructions, objmode);
+      const auto got = TIC28X::DecodeInstruction(data.data(), table);
+
+      ASSERT_EQ(want, got) << std::hex << "msw 0x" << msw << " lsw 0x" << lsw;
+    }
+  }
+}
+
+// Verify that the table driven decoder agrees with the linear decoder for
+// every instruction's opcode with its don't-care bits filled in
+TEST_P(TestDecodeTable, MatchesLinearDecoderForOpcodes) {
+  const TIC28X::ObjectMode objmode = GetParam();
+  const auto instructions = TIC28X::GetInstructions();
+  const auto& table = TIC28X::GetDecodeTable(objmode);
+  uint32_t seed = 0x28;
+
+  for (const auto inst : instructions) {
+    const uint32_t opcode = inst->GetOpcode();
+    const uint32_t free_bits = ~inst->GetOpcodeMask();
+
+    for (int sample = 0; sample < 64; sample++) {
+      const uint32_t bits = next_random(seed) & free_bits;
+      const uint32_t op32 =
+          inst->GetLength() == 2 ? (opcode | bits) << 16 : opcode | bits;
+      const std::array<uint8_t, 4> data = {
+          static_cast<uint8_t>(op32 >> 16 & 0xFF),
+          static_cast<uint8_t>(op32 >> 24),
+          static_cast<uint8_t>(op32 & 0xFF),
+          static_cast<uint8_t>(op32 >> 8 & 0xFF),
+      };
+
+      const auto want =
+          TIC28X::DecodeInstruction(data.data(), instructions, objmode);
+      const auto got = TIC28X::DecodeInstruction(data.data(), table);
+
+      ASSERT_EQ(want, got) << std::hex << "op 0x" << op32;
+    }
+  }
+}
+
+// Verify that the length table agrees with the full decoder for every
+// possible first halfword
+TEST_P(TestDecodeTable, PredecodeLengthMatchesDecoder) {
+  const TIC28X::ObjectMode objmode = GetParam();
+  const auto& table = TIC28X::GetDecodeTable(objmode);
+  const auto& lengths = TIC28X::GetLengthTable(objmode);
+
+  for (const uint16_t lsw : {0x0000, 0xFFFF}) {
+    for (uint32_t msw = 0; msw <= 0xFFFF; msw++) {
+      const std::array<uint8_t, 4> data = {
+          static_cast<uint8_t>(msw & 0xFF),
+          static_cast<uint8_t>(msw >> 8),
+          static_cast<uint8_t>(lsw & 0xFF),
+          static_cast<uint8_t>(lsw >> 8),
+      };
+
+      const auto length = TIC28X::PredecodeLength(data.data(), lengths);
+      if (const auto i = TIC28X::DecodeInstruction(data.data(), table)) {
+        ASSERT_EQ(i->GetLength(), length) << std::hex << "msw 0x" << msw;
+      } else if (table.Lookup16(msw) == TIC28X::DecodeTable::INVALID) {
+        ASSERT_EQ(0, length) << std::hex << "msw 0x" << msw;
+      } else {
+        // The MSW starts a 32-bit instruction but this LSW is rejected
+        ASSERT_EQ(4, length) << std::hex << "msw 0x" << msw;
+      }
+    }
+  }
+}
+
+// Verify that the bulk predecoder reports the length at every halfword
+TEST_P(TestDecodeTable, PredecodeLengths) {
+  const auto& lengths = TIC28X::GetLengthTable(GetParam());
+  std::array<uint8_t, 0x20000 + 1> data{};
+  for (size_t i = 0; i < 0x10000; i++) {
+    data[2 * i] = i & 0xFF;
+    data[2 * i + 1] = i >> 8;
+  }
+  std::array<uint8_t, 0x10000> out{};
+
+  ASSERT_EQ(out.size(), TIC28X::PredecodeLengths(data.data(), data.size(),
+                                                 out.data(), lengths));
+  for (uint32_t op16 = 0; op16 <= 0xFFFF; op16++) {
+    ASSERT_EQ(lengths.Lookup(op16), out[op16]) << std::hex << "op 0x" << op16;
+  }
+}
+
+// Verify that Decode resolves to the same instruction as DecodeInstruction and
+// records its opcode word and length
+TEST_P(TestDecodeTable, DecodeMatchesDecodeInstruction) {
+  const auto& table = TIC28X::GetDecodeTable(GetParam());
+
+  for (const uint16_t lsw : {0x0000, 0xFFFF}) {
+    for (uint32_t msw = 0; msw <= 0xFFFF; msw++) {
+      const std::array<uint8_t, 4> data = {
+          static_cast<uint8_t>(msw & 0xFF),
+          static_cast<uint8_t>(msw >> 8),
+          static_cast<uint8_t>(lsw & 0xFF),
+          static_cast<uint8_t>(lsw >> 8),
+      };
+
+      const auto want = TIC28X::DecodeInstruction(data.data(), table);
+      const auto decoded = TIC28X::Decode(data.data(), 0, table);
+      ASSERT_EQ(want != nullptr, decoded.has_value())
+          << std::hex << "msw 0x" << msw << " lsw 0x" << lsw;
+      if (!want) {
+        continue;
+      }
+      ASSERT_EQ(want, TIC28X::GetInstruction(*decoded));
+      ASSERT_EQ(want->GetLength(), decoded->length);
+      ASSERT_EQ(DataToOpcode(data.data(), decoded->length), decoded->word);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllObjmodes, TestDecodeTable,
+                         ::testing::ValuesIn(ALL_OBJMODES), objmode_name);
+
+// Verify that each object mode only sees its own variant of instructions that
+// have OBJMODE_0/OBJMODE_1 twins
+TEST(TestDecodeTable, ObjmodeTwins) {
+  const auto& table0 = TIC28X::GetDecodeTable(TIC28X::OBJMODE_0);
+  const auto& table1 = TIC28X::GetDecodeTable(TIC28X::OBJMODE_1);
+
+  const std::array<uint8_t, 4> op0 = {
+      TIC28X::MovAccLoc16Objmode0::opcode & 0xFF,
+      TIC28X::MovAccLoc16Objmode0::opcode >> 8, 0, 0};
+  const std::array<uint8_t, 4> op1 = {
+      TIC28X::MovAccLoc16Objmode1::opcode & 0xFF,
+      TIC28X::MovAccLoc16Objmode1::opcode >> 8, 0, 0};
+
+  const auto inst0 = TIC28X::DecodeInstruction(op0.data(), table0);
+  ASSERT_NE(inst0, nullptr);
+  EXPECT_STREQ(TIC28X::MovAccLoc16Objmode0::full_name, inst0->GetFullName());
+
+  const auto inst1 = TIC28X::DecodeInstruction(op1.data(), table1);
+  ASSERT_NE(inst1, nullptr);
+  EXPECT_STREQ(TIC28X::MovAccLoc16Objmode1::full_name, inst1->GetFullName());
+}
+
+// Verify that both RPT forms, and only they, repeat the next instruction, and
+// that an RPT that may be the LSW of a 32-bit instruction is left open
+TEST(TestDecodeTable, RepeatPrefix) {
+  const auto& table = TIC28X::GetDecodeTable(TIC28X::OBJMODE_1);
+  const uint16_t nop = TIC28X::NopIndArpn::SetInd(0xB8);  // NOP *
+  const auto prefix = [&table](const uint32_t first, const uint32_t second) {
+    const std::array<uint8_t, 4> data = {
+        static_cast<uint8_t>(first & 0xFF), static_cast<uint8_t>(first >> 8),
+        static_cast<uint8_t>(second & 0xFF), static_cast<uint8_t>(second >> 8)};
+    return TIC28X::IsRepeatPrefix(data.data(), table);
+  };
+
+  EXPECT_EQ(prefix(nop, TIC28X::RptConst8::SetConst8(0xFF)), true);
+  EXPECT_EQ(prefix(nop, TIC28X::RptLoc16::SetLoc16(0x80)), true);
+  EXPECT_EQ(prefix(0xFFFF, TIC28X::RptConst8::SetConst8(0xFF)), true);
+  EXPECT_EQ(prefix(nop, nop), false);
+  EXPECT_EQ(prefix(nop, 0xFFFF), false);
+
+  // LB 0x??xxxx, whose LSW looks like RPT #5
+  const uint16_t rpt = TIC28X::RptConst8::SetConst8(5);
+  const uint32_t lb = TIC28X::LbConst22::SetConst22(rpt);
+  EXPECT_EQ(prefix(lb >> 16, lb & 0xFFFF), std::nullopt);
+  // An MSW that needs its LSW to decode is just as ambiguous
+  uint32_t chained = 0;
+  while (table.Lookup16(chained) == TIC28X::DecodeTable::INVALID ||
+         !(table.Lookup16(chained) & TIC28X::DecodeTable::CHAIN)) {
+    ASSERT_LT(++chained, 0x10000u);
+  }
+  EXPECT_EQ(prefix(chained, rpt), std::nullopt);
+  EXPECT_STREQ(TIC28X::RptConst8::full_name,
+               TIC28X::Registry::FULL_NAMES[TIC28X::Registry::ID<
+                   TIC28X::RptConst8>]);
+}
+
+// Verify that operand fields never overlap each other or the opcode bits, and
+// that they fit in the instruction
+TEST(TestOperandFields, Disjoint) {
+  for (size_t id = 0; id < TIC28X::Registry::COUNT; id++) {
+    const uint64_t width = TIC28X::Registry::LENGTHS[id] * 8;
+    uint64_t used = TIC28X::Registry::OPCODE_MASKS[id];
+    ASSERT_LE(TIC28X::Registry::FIELDS[id].size(), TIC28X::MAX_FIELDS);
+    for (const auto& field : TIC28X::Registry::FIELDS[id]) {
+      const uint64_t bits = uint64_t{field.Mask()} << field.offset;
+      EXPECT_EQ(used & bits, 0u) << TIC28X::Registry::FULL_NAMES[id];
+      EXPECT_EQ(bits >> width, 0u) << TIC28X::Registry::FULL_NAMES[id];
+      used |= bits;
+    }
+  }
+}
+
+// Verify that ExtractOperands agrees with the accessors and sign extends
+// signed fields
+TEST(TestOperandFields, ExtractOperands) {
+  using TIC28X::BOff16Cond;
+  const std::array<uint8_t, 4> data = {
+      BOff16Cond::SetCond(0x3) >> 16 & 0xFF, BOff16Cond::opcode >> 24,
+      0xFE, 0xFF};  // offset -2
+  const auto decoded = TIC28X::Decode(
+      data.data(), 0, TIC28X::GetDecodeTable(TIC28X::OBJMODE_ANY));
+  ASSERT_TRUE(decoded);
+  ASSERT_STREQ(BOff16Cond::full_name,
+               TIC28X::GetInstruction(*decoded)->GetFullName());
+
+  const auto operands = TIC28X::ExtractOperands(*decoded);
+  ASSERT_EQ(operands.count, 2);
+  EXPECT_EQ(operands.values[0], -2);
+  EXPECT_EQ(BOff16Cond::GetOff16(decoded->word), 0xFFFE);
+  EXPECT_EQ(operands.values[1], 0x3);
+  EXPECT_EQ(operands.values[1], BOff16Cond::GetCond(decoded->word));
+}
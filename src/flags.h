@@ -4,6 +4,10 @@
 #ifndef TIC28X_FLAGS_H
 #define TIC28X_FLAGS_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 namespace TIC28X::Flags {
 // ST0 Flags
 constexpr uint8_t SXM = 0;
@@ -31,29 +35,23 @@ constexpr uint8_t M0M1MAP = 19;
 constexpr uint8_t XF = 20;
 constexpr uint8_t ARP = 21;
 
-inline std::unordered_map<uint32_t, std::string> NAMES = {
-    {SXM, "sxm"},
-    {OVM, "ovm"},
-    {TC, "tc"},
-    {C, "c"},
-    {Z, "z"},
-    {N, "n"},
-    {V, "v"},
-    {PM, "pm"},
-    {OVC, "ovc"},
-    {INTM, "intm"},
-    {DBGM, "dbgm"},
-    {PAGE0, "page0"},
-    {VMAP, "vmap"},
-    {SPA, "spa"},
-    {LOOP, "loop"},
-    {EALLOW, "eallow"},
-    {IDLESTAT, "idlestat"},
-    {AMODE, "amode"},
-    {OBJMODE, "objmode"},
-    {M0M1MAP, "m0m1map"},
-    {XF, "xf"},
-    {ARP, "arp"},
+// Number of flag ids
+constexpr size_t COUNT = ARP + 1;
+
+// Every flag id, in id order
+inline constexpr std::array<uint32_t, COUNT> ALL = [] {
+  std::array<uint32_t, COUNT> all = {};
+  for (uint32_t flag = 0; flag < COUNT; flag++) {
+    all[flag] = flag;
+  }
+  return all;
+}();
+
+// Flag names, indexed by flag id
+inline constexpr std::array<const char*, COUNT> NAMES = {
+    "sxm", "ovm", "tc", "c", "z", "n", "v", "pm", "ovc", "intm", "dbgm",
+    "page0", "vmap", "spa", "loop", "eallow", "idlestat", "amode", "objmode",
+    "m0m1map", "xf", "arp",
 };
 
 }  // namespace TIC28X::Flags
@@ -0,0 +1,42 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_HOT_INSTRUCTIONS_H
+#define TIC28X_HOT_INSTRUCTIONS_H
+
+#include <array>
+
+namespace TIC28X {
+/**
+ * HOT_INSTRUCTIONS - the instruction classes (by full name) whose text cache
+ * entries are kept when colder encodings collide with them (see
+ * TextCache::Insert), hottest first.
+ *
+ * This is a hand-picked seed list, not a measured one: the register, stack
+ * and accumulator moves, DP loads, calls and returns that compiled control
+ * code is expected to be made of. Replace it with a decode profile of
+ * representative firmware by running
+ * `tic28x_profile --header src/hot_instructions.h <binary>`. Only address
+ * independent classes may be listed, since only their text is cached.
+ */
+inline constexpr std::array<const char*, 16> HOT_INSTRUCTIONS = {
+    "MovlXar4Loc32",
+    "MovlLoc32Xar4",
+    "MovlAccLoc32",
+    "MovlLoc32Acc",
+    "MovAxLoc16",
+    "MovLoc16Ax",
+    "MovwDpConst16",
+    "LcrConst22",
+    "Lretr",
+    "AddbSpConst7",
+    "AddbXarnConst7",
+    "AddbAccConst8",
+    "MovlXar5Loc32",
+    "MovlLoc32Xar5",
+    "MovlXar6Loc32",
+    "MovlLoc32Xar6",
+};
+}  // namespace TIC28X
+
+#endif  // TIC28X_HOT_INSTRUCTIONS_H
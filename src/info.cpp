@@ -6,18 +6,17 @@
 #include <binaryninjaapi.h>
 
 #include "instructions.h"
-#include "util.h"
 
 namespace TIC28X {
 /* Default Info Methods */
-bool Instruction2Byte::Info(const uint8_t* data, uint64_t addr,
+bool Instruction2Byte::Info(const DecodedInstruction& decoded, uint64_t addr,
                             BN::InstructionInfo& result,
                             TIC28XArchitecture* arch) {
   result.length = GetLength();
   return true;
 }
 
-bool Instruction4Byte::Info(const uint8_t* data, uint64_t addr,
+bool Instruction4Byte::Info(const DecodedInstruction& decoded, uint64_t addr,
                             BN::InstructionInfo& result,
                             TIC28XArchitecture* arch) {
   result.length = GetLength();
@@ -26,75 +25,69 @@ bool Instruction4Byte::Info(const uint8_t* data, uint64_t addr,
 
 /* Instruction-specific info methods */
 
-bool BOff16Cond::Info(const uint8_t* data, const uint64_t addr,
+bool BOff16Cond::Info(const DecodedInstruction& decoded, const uint64_t addr,
                       BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool BanzOff16Arn::Info(const uint8_t* data, const uint64_t addr,
+bool BanzOff16Arn::Info(const DecodedInstruction& decoded, const uint64_t addr,
                         BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool BarOff16ArnArmEq::Info(const uint8_t* data, const uint64_t addr,
-                            BN::InstructionInfo& result,
+bool BarOff16ArnArmEq::Info(const DecodedInstruction& decoded,
+                            const uint64_t addr, BN::InstructionInfo& result,
                             TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool BarOff16ArnArmNeq::Info(const uint8_t* data, const uint64_t addr,
-                             BN::InstructionInfo& result,
+bool BarOff16ArnArmNeq::Info(const DecodedInstruction& decoded,
+                             const uint64_t addr, BN::InstructionInfo& result,
                              TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool BfOff16Cond::Info(const uint8_t* data, const uint64_t addr,
+bool BfOff16Cond::Info(const DecodedInstruction& decoded, const uint64_t addr,
                        BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool FfcXar7Const22::Info(const uint8_t* data, const uint64_t addr,
-                          BN::InstructionInfo& result,
+bool FfcXar7Const22::Info(const DecodedInstruction& decoded,
+                          const uint64_t addr, BN::InstructionInfo& result,
                           TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(CallDestination, GetTarget(dataOp, addr));
+  result.AddBranch(CallDestination, decoded.target);
 
   return true;
 }
 
-bool IntrIntx::Info(const uint8_t* data, const uint64_t addr,
+bool IntrIntx::Info(const DecodedInstruction& decoded, const uint64_t addr,
                     BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -103,7 +96,7 @@ bool IntrIntx::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool IntrNmi::Info(const uint8_t* data, const uint64_t addr,
+bool IntrNmi::Info(const DecodedInstruction& decoded, const uint64_t addr,
                    BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -112,7 +105,7 @@ bool IntrNmi::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool IntrEmuint::Info(const uint8_t* data, const uint64_t addr,
+bool IntrEmuint::Info(const DecodedInstruction& decoded, const uint64_t addr,
                       BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -121,7 +114,7 @@ bool IntrEmuint::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool Iret::Info(const uint8_t* data, const uint64_t addr,
+bool Iret::Info(const DecodedInstruction& decoded, const uint64_t addr,
                 BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -130,7 +123,7 @@ bool Iret::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool LbXar7::Info(const uint8_t* data, const uint64_t addr,
+bool LbXar7::Info(const DecodedInstruction& decoded, const uint64_t addr,
                   BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -139,17 +132,16 @@ bool LbXar7::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool LbConst22::Info(const uint8_t* data, const uint64_t addr,
+bool LbConst22::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(UnconditionalBranch, GetTarget(dataOp, addr));
+  result.AddBranch(UnconditionalBranch, decoded.target);
 
   return true;
 }
 
-bool LcXar7::Info(const uint8_t* data, const uint64_t addr,
+bool LcXar7::Info(const DecodedInstruction& decoded, const uint64_t addr,
                   BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -158,27 +150,25 @@ bool LcXar7::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool LcConst22::Info(const uint8_t* data, const uint64_t addr,
+bool LcConst22::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(CallDestination, GetTarget(dataOp, addr));
+  result.AddBranch(CallDestination, decoded.target);
 
   return true;
 }
 
-bool LcrConst22::Info(const uint8_t* data, const uint64_t addr,
+bool LcrConst22::Info(const DecodedInstruction& decoded, const uint64_t addr,
                       BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(CallDestination, GetTarget(dataOp, addr));
+  result.AddBranch(CallDestination, decoded.target);
 
   return true;
 }
 
-bool LcrXarn::Info(const uint8_t* data, const uint64_t addr,
+bool LcrXarn::Info(const DecodedInstruction& decoded, const uint64_t addr,
                    BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -187,8 +177,8 @@ bool LcrXarn::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool LoopnzLoc16Const16::Info(const uint8_t* data, const uint64_t addr,
-                              BN::InstructionInfo& result,
+bool LoopnzLoc16Const16::Info(const DecodedInstruction& decoded,
+                              const uint64_t addr, BN::InstructionInfo& result,
                               TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -201,8 +191,8 @@ bool LoopnzLoc16Const16::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool LoopzLoc16Const16::Info(const uint8_t* data, const uint64_t addr,
-                             BN::InstructionInfo& result,
+bool LoopzLoc16Const16::Info(const DecodedInstruction& decoded,
+                             const uint64_t addr, BN::InstructionInfo& result,
                              TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -215,7 +205,7 @@ bool LoopzLoc16Const16::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool Lret::Info(const uint8_t* data, const uint64_t addr,
+bool Lret::Info(const DecodedInstruction& decoded, const uint64_t addr,
                 BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -224,7 +214,7 @@ bool Lret::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool Lrete::Info(const uint8_t* data, const uint64_t addr,
+bool Lrete::Info(const DecodedInstruction& decoded, const uint64_t addr,
                  BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -233,7 +223,7 @@ bool Lrete::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool Lretr::Info(const uint8_t* data, const uint64_t addr,
+bool Lretr::Info(const DecodedInstruction& decoded, const uint64_t addr,
                  BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -242,7 +232,7 @@ bool Lretr::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool RptConst8::Info(const uint8_t* data, const uint64_t addr,
+bool RptConst8::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -252,7 +242,7 @@ bool RptConst8::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool RptLoc16::Info(const uint8_t* data, const uint64_t addr,
+bool RptLoc16::Info(const DecodedInstruction& decoded, const uint64_t addr,
                     BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -262,62 +252,57 @@ bool RptLoc16::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool SbOff8Cond::Info(const uint8_t* data, const uint64_t addr,
+bool SbOff8Cond::Info(const DecodedInstruction& decoded, const uint64_t addr,
                       BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool SbfOff8Eq::Info(const uint8_t* data, const uint64_t addr,
+bool SbfOff8Eq::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool SbfOff8Neq::Info(const uint8_t* data, const uint64_t addr,
+bool SbfOff8Neq::Info(const DecodedInstruction& decoded, const uint64_t addr,
                       BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool SbfOff8Tc::Info(const uint8_t* data, const uint64_t addr,
+bool SbfOff8Tc::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool SbfOff8Ntc::Info(const uint8_t* data, const uint64_t addr,
+bool SbfOff8Ntc::Info(const DecodedInstruction& decoded, const uint64_t addr,
                       BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool TrapVec::Info(const uint8_t* data, const uint64_t addr,
+bool TrapVec::Info(const DecodedInstruction& decoded, const uint64_t addr,
                    BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -326,7 +311,7 @@ bool TrapVec::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool XbAl::Info(const uint8_t* data, const uint64_t addr,
+bool XbAl::Info(const DecodedInstruction& decoded, const uint64_t addr,
                 BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -335,147 +320,139 @@ bool XbAl::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool XbPmaArpn::Info(const uint8_t* data, const uint64_t addr,
+bool XbPmaArpn::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(UnconditionalBranch, GetTarget(dataOp, addr));
+  result.AddBranch(UnconditionalBranch, decoded.target);
 
   return true;
 }
 
-bool XbPmaCond::Info(const uint8_t* data, const uint64_t addr,
+bool XbPmaCond::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaInd::Info(const uint8_t* data, const uint64_t addr,
+bool XbanzPmaInd::Info(const DecodedInstruction& decoded, const uint64_t addr,
                        BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaIndPostinc::Info(const uint8_t* data, const uint64_t addr,
-                              BN::InstructionInfo& result,
+bool XbanzPmaIndPostinc::Info(const DecodedInstruction& decoded,
+                              const uint64_t addr, BN::InstructionInfo& result,
                               TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaIndPostdec::Info(const uint8_t* data, const uint64_t addr,
-                              BN::InstructionInfo& result,
+bool XbanzPmaIndPostdec::Info(const DecodedInstruction& decoded,
+                              const uint64_t addr, BN::InstructionInfo& result,
                               TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaInd0Postinc::Info(const uint8_t* data, const uint64_t addr,
-                               BN::InstructionInfo& result,
+bool XbanzPmaInd0Postinc::Info(const DecodedInstruction& decoded,
+                               const uint64_t addr, BN::InstructionInfo& result,
                                TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaInd0Postdec::Info(const uint8_t* data, const uint64_t addr,
-                               BN::InstructionInfo& result,
+bool XbanzPmaInd0Postdec::Info(const DecodedInstruction& decoded,
+                               const uint64_t addr, BN::InstructionInfo& result,
                                TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaIndArpn::Info(const uint8_t* data, const uint64_t addr,
-                           BN::InstructionInfo& result,
+bool XbanzPmaIndArpn::Info(const DecodedInstruction& decoded,
+                           const uint64_t addr, BN::InstructionInfo& result,
                            TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaIndPostincArpn::Info(const uint8_t* data, const uint64_t addr,
+bool XbanzPmaIndPostincArpn::Info(const DecodedInstruction& decoded,
+                                  const uint64_t addr,
                                   BN::InstructionInfo& result,
                                   TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaIndPostdecArpn::Info(const uint8_t* data, const uint64_t addr,
+bool XbanzPmaIndPostdecArpn::Info(const DecodedInstruction& decoded,
+                                  const uint64_t addr,
                                   BN::InstructionInfo& result,
                                   TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaInd0PostincArpn::Info(const uint8_t* data, const uint64_t addr,
+bool XbanzPmaInd0PostincArpn::Info(const DecodedInstruction& decoded,
+                                   const uint64_t addr,
                                    BN::InstructionInfo& result,
                                    TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XbanzPmaInd0PostdecArpn::Info(const uint8_t* data, const uint64_t addr,
+bool XbanzPmaInd0PostdecArpn::Info(const DecodedInstruction& decoded,
+                                   const uint64_t addr,
                                    BN::InstructionInfo& result,
                                    TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XcallAl::Info(const uint8_t* data, const uint64_t addr,
+bool XcallAl::Info(const DecodedInstruction& decoded, const uint64_t addr,
                    BN::InstructionInfo& result, TIC28XArchitecture* arch) {
   result.length = GetLength();
 
@@ -484,30 +461,27 @@ bool XcallAl::Info(const uint8_t* data, const uint64_t addr,
   return true;
 }
 
-bool XcallPmaArpn::Info(const uint8_t* data, const uint64_t addr,
+bool XcallPmaArpn::Info(const DecodedInstruction& decoded, const uint64_t addr,
                         BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(UnconditionalBranch, GetTarget(dataOp, addr));
+  result.AddBranch(UnconditionalBranch, decoded.target);
 
   return true;
 }
 
-bool XcallPmaCond::Info(const uint8_t* data, const uint64_t addr,
+bool XcallPmaCond::Info(const DecodedInstruction& decoded, const uint64_t addr,
                         BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
-  result.AddBranch(TrueBranch, GetTarget(dataOp, addr));
+  result.AddBranch(TrueBranch, decoded.target);
   result.AddBranch(FalseBranch, addr + result.length);
 
   return true;
 }
 
-bool XretcCond::Info(const uint8_t* data, const uint64_t addr,
+bool XretcCond::Info(const DecodedInstruction& decoded, const uint64_t addr,
                      BN::InstructionInfo& result, TIC28XArchitecture* arch) {
-  const auto dataOp = DataToOpcode(data, GetLength());
   result.length = GetLength();
 
   result.AddBranch(FunctionReturn);
@@ -6,56 +6,142 @@
 
 #include <binaryninjaapi.h>
 
+#include <array>
+#include <span>
+#include <string_view>
+
 #include "architecture.h"
 #include "opcodes.h"
 #include "sizes.h"
+#include "text_tokens.h"
 
 namespace BN = BinaryNinja;
 
 namespace TIC28X {
 
-/* Instruction Operand Extractors */
-uint8_t FpuGetRegA_I(uint32_t data);
-uint32_t FpuSetRegA_I(uint32_t opcode, uint8_t a);
-uint8_t FpuGetRegB_I(uint32_t data);
-uint32_t FpuSetRegB_I(uint32_t opcode, uint8_t b);
-uint8_t FpuGetRegC_I(uint32_t data);
-uint32_t FpuSetRegC_I(uint32_t opcode, uint8_t c);
-uint16_t FpuGet16FHi_I(uint32_t data);
-uint32_t FpuSet16FHi_I(uint32_t opcode, uint16_t i);
-
-uint8_t FpuGetRegA_II(uint32_t data);
-uint32_t FpuSetRegA_II(uint32_t opcode, uint8_t a);
-uint8_t FpuGetRegD_II(uint32_t data);
-uint32_t FpuSetRegD_II(uint32_t opcode, uint8_t d);
-uint8_t FpuGetRegE_II(uint32_t data);
-uint32_t FpuSetRegE_II(uint32_t opcode, uint8_t e);
-uint8_t FpuGetRegF_II(uint32_t data);
-uint32_t FpuSetRegF_II(uint32_t opcode, uint8_t f);
-
-uint8_t FpuGetRegA_III(uint32_t data);
-uint32_t FpuSetRegA_III(uint32_t opcode, uint8_t a);
-uint16_t FpuGet16FHi_III(uint32_t data);
-uint32_t FpuSet16FHi_III(uint32_t opcode, uint16_t i);
-
-uint8_t FpuGetRegD_IV(uint32_t data);
-uint32_t FpuSetRegD_IV(uint32_t opcode, uint8_t d);
-uint8_t FpuGetRegE_IV(uint32_t data);
-uint32_t FpuSetRegE_IV(uint32_t opcode, uint8_t e);
-uint8_t FpuGetRegF_IV(uint32_t data);
-uint32_t FpuSetRegF_IV(uint32_t opcode, uint8_t f);
-
-uint8_t FpuGetMem(uint32_t data);
-uint32_t FpuSetMem(uint32_t opcode, uint8_t mem);
+/**
+ * OperandKind - what an instruction operand field encodes.
+ */
+enum OperandKind : uint8_t {
+  OPERAND_LOC16,      // 16-bit addressing mode (loc16, mem16, *ind)
+  OPERAND_LOC32,      // 32-bit addressing mode (loc32, mem32)
+  OPERAND_REGISTER,   // register number
+  OPERAND_CONSTANT,   // immediate value
+  OPERAND_SHIFT,      // shift count
+  OPERAND_CONDITION,  // condition code
+  OPERAND_OFFSET,     // signed branch offset
+  OPERAND_MODE,       // product shift or addressing mode bits
+};
+
+/**
+ * Field - describes where an operand lives in an instruction word.
+ *
+ * Every operand of every instruction is a contiguous run of bits, so one
+ * descriptor replaces the mask and shift each accessor used to repeat. For
+ * 32-bit instructions the word is laid out as returned by DataToOpcode (MSW
+ * in the upper half).
+ */
+struct Field {
+  uint8_t offset;  // bit position of the least significant bit
+  uint8_t width;   // number of bits
+  OperandKind kind;
+  bool is_signed = false;
+
+  [[nodiscard]] constexpr uint32_t Mask() const {
+    return static_cast<uint32_t>((uint64_t{1} << width) - 1);
+  }
+  // Raw (zero extended) field value
+  [[nodiscard]] constexpr uint32_t Get(const uint32_t data) const {
+    return data >> offset & Mask();
+  }
+  // Field value moved into place, for OR-ing into an opcode
+  [[nodiscard]] constexpr uint32_t Set(const uint32_t value) const {
+    return (value & Mask()) << offset;
+  }
+  // Field value, sign extended if the field is signed
+  [[nodiscard]] constexpr int32_t Extract(const uint32_t data) const {
+    const unsigned unused = (32u - width) & -static_cast<unsigned>(is_signed);
+    return static_cast<int32_t>(Get(data) << unused) >> unused;
+  }
+};
+
+// Most operand fields any single instruction has
+constexpr size_t MAX_FIELDS = 5;
+
+// Most text tokens one operand of each kind renders, separator included
+inline constexpr std::array<uint8_t, OPERAND_MODE + 1> OPERAND_TEXT_TOKENS = {
+    10,  // OPERAND_LOC16, e.g. *+XAR6[AR1%++] or *BR0--,ARPn
+    10,  // OPERAND_LOC32
+    4,   // OPERAND_REGISTER
+    5,   // OPERAND_CONSTANT, e.g. *(0:16bit)
+    5,   // OPERAND_SHIFT, e.g. << #16
+    2,   // OPERAND_CONDITION
+    4,   // OPERAND_OFFSET
+    16,  // OPERAND_MODE, up to eight status bits
+};
+
+// Most text tokens of a mnemonic and the operands an instruction implies
+// rather than encodes (ACC, P, XAR7, shifts by PM, ...)
+constexpr size_t FIXED_TEXT_TOKENS = 9;
+
+/**
+ * MaxTextTokens - the most tokens Text renders for an instruction class: its
+ * measured count from TEXT_TOKENS, or for a class that has not been measured
+ * yet, an upper bound known from its operand fields alone.
+ *
+ * @param name - full name of the instruction class
+ * @param fields - operand fields of the instruction
+ * @return most tokens its text can take
+ */
+constexpr size_t MaxTextTokens(const std::string_view name,
+                               const std::span<const Field> fields) {
+  for (const auto& [listed, tokens] : TEXT_TOKENS) {
+    if (name == listed) {
+      return tokens;
+    }
+  }
+  size_t count = FIXED_TEXT_TOKENS;
+  for (const auto& field : fields) {
+    count += OPERAND_TEXT_TOKENS[field.kind];
+  }
+  return count;
+}
+
+// Floating point operand layouts, shared by the FPU instruction classes
+
+// Floating Point reg A-C, 16FHi fields, format I:
+// LSW: xxxx xxxx xxxx xxxx
+// MSW: xxxx xxxc ccbb baaa
+// OR
+// LSW: xxxx xxxx xxII IIII
+// MSW: IIII IIII IIbb baaa
+
+// Floating Point reg A, D-F fields, format II:
+// LSW: xxxx xxxx xxxx fffe
+// MSW: eedd daaa xxxx xxxx
+
+// Floating point reg A, 16FHi fields, format III
+// LSW: xxxx xxxx xxxx xIII
+// MSW: IIII IIII IIII Iaaa
+
+// Floating point reg D-F, format IV
+// LSW: xxxx xxxx xxxx xxff
+// MSW: feee dddc ccbb baaa
+// A-C regs are covered in format I
 
 /**
  * 16-bit Instruction class
  */
 class Instruction2Byte : public Instruction {
  public:
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
-  size_t GetLength() override { return Sizes::_2_BYTES; }
+  static constexpr size_t length = Sizes::_2_BYTES;
+  static constexpr BranchKind branch = BRANCH_NONE;
+  static constexpr bool address_independent = true;
+  static constexpr std::array<Field, 0> fields = {};
+
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
+  size_t GetLength() override { return length; }
 };
 
 /**
@@ -63,20 +149,26 @@ class Instruction2Byte : public Instruction {
  */
 class Instruction4Byte : public Instruction {
  public:
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
-  size_t GetLength() override { return Sizes::_4_BYTES; }
+  static constexpr size_t length = Sizes::_4_BYTES;
+  static constexpr BranchKind branch = BRANCH_NONE;
+  static constexpr bool address_independent = true;
+  static constexpr std::array<Field, 0> fields = {};
+
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
+  size_t GetLength() override { return length; }
 };
 
 /* Helper Functions */
-std::optional<std::shared_ptr<Instruction>> DecodeInstruction(
-    const uint8_t* data,
-    const std::vector<std::optional<std::shared_ptr<Instruction>>>&
-        instruction_list,
-    ObjectMode objmode);
+Instruction* DecodeInstruction(const uint8_t* data,
+                               std::span<Instruction* const> instruction_list,
+                               ObjectMode objmode);
 
-std::vector<std::optional<std::shared_ptr<Instruction>>>
-GenerateInstructionVector();
+Instruction* DecodeInstruction32(const uint8_t* data,
+                                 std::span<Instruction* const> instruction_list,
+                                 ObjectMode objmode);
+
+std::span<Instruction* const> GetInstructions();
 
 /* Final CPU Instruction Classes
  * Note: the instruction data is declared public so it can be accessed for
@@ -87,7 +179,7 @@ GenerateInstructionVector();
  */
 class Aborti final : public Instruction2Byte {
  public:
-  Aborti() : Instruction2Byte() {}
+  constexpr Aborti() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ABORTI;
@@ -106,17 +198,17 @@ class Aborti final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
 };
 
 class AbsAcc final : public Instruction2Byte {
  public:
-  AbsAcc() : Instruction2Byte() {}
+  constexpr AbsAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ABS_ACC;
@@ -135,17 +227,17 @@ class AbsAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
 };
 
 class AbstcAcc final : public Instruction2Byte {
  public:
-  AbstcAcc() : Instruction2Byte() {}
+  constexpr AbstcAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ABSTC_ACC;
@@ -164,17 +256,17 @@ class AbstcAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
 };
 
 class AddAccConst16Shift final : public Instruction4Byte {
  public:
-  AddAccConst16Shift() : Instruction4Byte() {}
+  constexpr AddAccConst16Shift() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_ACC_CONST16_SHIFT;
@@ -192,25 +284,38 @@ class AddAccConst16Shift final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {16, 4, OPERAND_SHIFT};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {shift_field, const16_field};
+
   /* Helper functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddAccLoc16ShiftT final : public Instruction4Byte {
  public:
-  AddAccLoc16ShiftT() : Instruction4Byte() {}
+  constexpr AddAccLoc16ShiftT() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_ACC_LOC16_SHIFT_T;
@@ -228,23 +333,31 @@ class AddAccLoc16ShiftT final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddAccLoc16 final : public Instruction2Byte {
  public:
-  AddAccLoc16() : Instruction2Byte() {}
+  constexpr AddAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_ACC_LOC16;
@@ -262,23 +375,31 @@ class AddAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddAccLoc16Shift1_15 final : public Instruction4Byte {
  public:
-  AddAccLoc16Shift1_15() : Instruction4Byte() {}
+  constexpr AddAccLoc16Shift1_15() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_ACC_LOC16_SHIFT1_15;
@@ -296,25 +417,38 @@ class AddAccLoc16Shift1_15 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {8, 4, OPERAND_SHIFT};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {shift_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddAccLoc16Shift16 final : public Instruction2Byte {
  public:
-  AddAccLoc16Shift16() : Instruction2Byte() {}
+  constexpr AddAccLoc16Shift16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_ACC_LOC16_SHIFT16;
@@ -332,23 +466,31 @@ class AddAccLoc16Shift16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddAccLoc16Shift0_15 final : public Instruction2Byte {
  public:
-  AddAccLoc16Shift0_15() : Instruction2Byte() {}
+  constexpr AddAccLoc16Shift0_15() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_ACC_LOC16_SHIFT0_15;
@@ -366,25 +508,38 @@ class AddAccLoc16Shift0_15 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {8, 4, OPERAND_SHIFT};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {shift_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddAxLoc16 final : public Instruction2Byte {
  public:
-  AddAxLoc16() : Instruction2Byte() {}
+  constexpr AddAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_AX_LOC16;
@@ -402,25 +557,38 @@ class AddAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddLoc16Ax final : public Instruction2Byte {
  public:
-  AddLoc16Ax() : Instruction2Byte() {}
+  constexpr AddLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_LOC16_AX;
@@ -438,25 +606,38 @@ class AddLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {loc16_field, reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddLoc16Const16 final : public Instruction4Byte {
  public:
-  AddLoc16Const16() : Instruction4Byte() {}
+  constexpr AddLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADD_LOC16_CONST16;
@@ -474,25 +655,38 @@ class AddLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddbAccConst8 final : public Instruction2Byte {
  public:
-  AddbAccConst8() : Instruction2Byte() {}
+  constexpr AddbAccConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDB_ACC_CONST8;
@@ -510,23 +704,31 @@ class AddbAccConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddbAxConst8 final : public Instruction2Byte {
  public:
-  AddbAxConst8() : Instruction2Byte() {}
+  constexpr AddbAxConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDB_AX_CONST8;
@@ -544,25 +746,38 @@ class AddbAxConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, const8_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddbSpConst7 final : public Instruction2Byte {
  public:
-  AddbSpConst7() : Instruction2Byte() {}
+  constexpr AddbSpConst7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDB_SP_CONST7;
@@ -580,23 +795,31 @@ class AddbSpConst7 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const7_field = {0, 7, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const7_field};
+
   /* Helper Functions */
-  static uint8_t GetConst7(uint32_t data);
-  static uint32_t SetConst7(uint8_t const7);
+  static constexpr uint8_t GetConst7(const uint32_t data) {
+    return const7_field.Get(data);
+  }
+  static constexpr uint32_t SetConst7(const uint8_t const7) {
+    return opcode | const7_field.Set(const7);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddbXarnConst7 final : public Instruction2Byte {
  public:
-  AddbXarnConst7() : Instruction2Byte() {}
+  constexpr AddbXarnConst7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDB_XARN_CONST7;
@@ -614,25 +837,38 @@ class AddbXarnConst7 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_n_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field const7_field = {0, 7, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_n_field, const7_field};
+
   /* Helper Functions */
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
-  static uint8_t GetConst7(uint32_t data);
-  static uint32_t SetConst7(uint8_t const7);
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
+  static constexpr uint8_t GetConst7(const uint32_t data) {
+    return const7_field.Get(data);
+  }
+  static constexpr uint32_t SetConst7(const uint8_t const7) {
+    return opcode | const7_field.Set(const7);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddclAccLoc32 final : public Instruction4Byte {
  public:
-  AddclAccLoc32() : Instruction4Byte() {}
+  constexpr AddclAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDCL_ACC_LOC32;
@@ -650,23 +886,31 @@ class AddclAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddcuAccLoc16 final : public Instruction2Byte {
  public:
-  AddcuAccLoc16() : Instruction2Byte() {}
+  constexpr AddcuAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDCU_ACC_LOC16;
@@ -684,23 +928,31 @@ class AddcuAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddlAccLoc32 final : public Instruction2Byte {
  public:
-  AddlAccLoc32() : Instruction2Byte() {}
+  constexpr AddlAccLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDL_ACC_LOC32;
@@ -718,23 +970,31 @@ class AddlAccLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddlAccPShiftPm final : public Instruction2Byte {
  public:
-  AddlAccPShiftPm() : Instruction2Byte() {}
+  constexpr AddlAccPShiftPm() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDL_ACC_P_SHIFT_PM;
@@ -753,18 +1013,18 @@ class AddlAccPShiftPm final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddlLoc32Acc final : public Instruction4Byte {
  public:
-  AddlLoc32Acc() : Instruction4Byte() {}
+  constexpr AddlLoc32Acc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDL_LOC32_ACC;
@@ -782,23 +1042,31 @@ class AddlLoc32Acc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AdduAccLoc16 final : public Instruction2Byte {
  public:
-  AdduAccLoc16() : Instruction2Byte() {}
+  constexpr AdduAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDU_ACC_LOC16;
@@ -816,23 +1084,31 @@ class AdduAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddulPLoc32 final : public Instruction4Byte {
  public:
-  AddulPLoc32() : Instruction4Byte() {}
+  constexpr AddulPLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDUL_P_LOC32;
@@ -850,23 +1126,31 @@ class AddulPLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AddulAccLoc32 final : public Instruction4Byte {
  public:
-  AddulAccLoc32() : Instruction4Byte() {}
+  constexpr AddulAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDUL_ACC_LOC32;
@@ -884,23 +1168,31 @@ class AddulAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AdrkImm8 final : public Instruction2Byte {
  public:
-  AdrkImm8() : Instruction2Byte() {}
+  constexpr AdrkImm8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADRK_IMM8;
@@ -918,23 +1210,31 @@ class AdrkImm8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field imm8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {imm8_field};
+
   /* Helper Functions */
-  static uint8_t GetImm8(uint32_t data);
-  static uint32_t SetImm8(uint8_t imm8);
+  static constexpr uint8_t GetImm8(const uint32_t data) {
+    return imm8_field.Get(data);
+  }
+  static constexpr uint32_t SetImm8(const uint8_t imm8) {
+    return opcode | imm8_field.Set(imm8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndAccConst16Shift0_15 final : public Instruction4Byte {
  public:
-  AndAccConst16Shift0_15() : Instruction4Byte() {}
+  constexpr AndAccConst16Shift0_15() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_ACC_CONST16_SHIFT0_15;
@@ -952,25 +1252,38 @@ class AndAccConst16Shift0_15 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field shift_field = {16, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {const16_field, shift_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndAccConst16Shift16 final : public Instruction4Byte {
  public:
-  AndAccConst16Shift16() : Instruction4Byte() {}
+  constexpr AndAccConst16Shift16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_ACC_CONST16_SHIFT16;
@@ -988,23 +1301,31 @@ class AndAccConst16Shift16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndAccLoc16 final : public Instruction2Byte {
  public:
-  AndAccLoc16() : Instruction2Byte() {}
+  constexpr AndAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_ACC_LOC16;
@@ -1022,23 +1343,31 @@ class AndAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndAxLoc16Const16 final : public Instruction4Byte {
  public:
-  AndAxLoc16Const16() : Instruction4Byte() {}
+  constexpr AndAxLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_AX_LOC16_CONST16;
@@ -1056,27 +1385,46 @@ class AndAxLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {24, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, loc16_field,
+                                        const16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndIerConst16 final : public Instruction4Byte {
  public:
-  AndIerConst16() : Instruction4Byte() {}
+  constexpr AndIerConst16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_IER_CONST16;
@@ -1094,23 +1442,31 @@ class AndIerConst16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndIfrConst16 final : public Instruction4Byte {
  public:
-  AndIfrConst16() : Instruction4Byte() {}
+  constexpr AndIfrConst16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_IFR_CONST16;
@@ -1128,23 +1484,31 @@ class AndIfrConst16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndLoc16Ax final : public Instruction2Byte {
  public:
-  AndLoc16Ax() : Instruction2Byte() {}
+  constexpr AndLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_LOC16_AX;
@@ -1162,25 +1526,38 @@ class AndLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {loc16_field, reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndAxLoc16 final : public Instruction2Byte {
  public:
-  AndAxLoc16() : Instruction2Byte() {}
+  constexpr AndAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_AX_LOC16;
@@ -1198,25 +1575,38 @@ class AndAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {loc16_field, reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndLoc16Const16 final : public Instruction4Byte {
  public:
-  AndLoc16Const16() : Instruction4Byte() {}
+  constexpr AndLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::AND_LOC16_CONST16;
@@ -1234,25 +1624,38 @@ class AndLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AndbAxConst8 final : public Instruction2Byte {
  public:
-  AndbAxConst8() : Instruction2Byte() {}
+  constexpr AndbAxConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ANDB_AX_CONST8;
@@ -1270,25 +1673,38 @@ class AndbAxConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, const8_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Asp final : public Instruction2Byte {
  public:
-  Asp() : Instruction2Byte() {}
+  constexpr Asp() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ASP;
@@ -1307,18 +1723,18 @@ class Asp final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AsrAxShift final : public Instruction2Byte {
  public:
-  AsrAxShift() : Instruction2Byte() {}
+  constexpr AsrAxShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ASR_AX_SHIFT;
@@ -1336,25 +1752,38 @@ class AsrAxShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {4, 1, OPERAND_REGISTER};
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {reg_ax_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AsrAxT final : public Instruction2Byte {
  public:
-  AsrAxT() : Instruction2Byte() {}
+  constexpr AsrAxT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ASR_AX_T;
@@ -1372,23 +1801,31 @@ class AsrAxT final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Asr64AccPShift final : public Instruction2Byte {
  public:
-  Asr64AccPShift() : Instruction2Byte() {}
+  constexpr Asr64AccPShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ASR64_ACC_P_SHIFT;
@@ -1406,23 +1843,31 @@ class Asr64AccPShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {shift_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Asr64AccPT final : public Instruction2Byte {
  public:
-  Asr64AccPT() : Instruction2Byte() {}
+  constexpr Asr64AccPT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ASR64_ACC_P_T;
@@ -1441,18 +1886,18 @@ class Asr64AccPT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class AsrlAccT final : public Instruction2Byte {
  public:
-  AsrlAccT() : Instruction2Byte() {}
+  constexpr AsrlAccT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ASRL_ACC_T;
@@ -1471,18 +1916,18 @@ class AsrlAccT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class BOff16Cond final : public Instruction4Byte {
  public:
-  BOff16Cond() : Instruction4Byte() {}
+  constexpr BOff16Cond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::B_OFF16_COND;
@@ -1491,6 +1936,8 @@ class BOff16Cond final : public Instruction4Byte {
   static constexpr auto op_name = "b";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -1500,29 +1947,42 @@ class BOff16Cond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off16_field = {0, 16, OPERAND_OFFSET, true};
+  static constexpr Field cond_field = {16, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {off16_field, cond_field};
+
   /* Helper Functions */
-  static uint16_t GetOff16(uint32_t data);
-  static uint32_t SetOff16(uint16_t off16);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint16_t GetOff16(const uint32_t data) {
+    return off16_field.Get(data);
+  }
+  static constexpr uint32_t SetOff16(const uint16_t off16) {
+    return opcode | off16_field.Set(off16);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class BanzOff16Arn final : public Instruction4Byte {
  public:
-  BanzOff16Arn() : Instruction4Byte() {}
+  constexpr BanzOff16Arn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::BANZ_OFF16_ARN;
@@ -1531,6 +1991,8 @@ class BanzOff16Arn final : public Instruction4Byte {
   static constexpr auto op_name = "banz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -1540,29 +2002,42 @@ class BanzOff16Arn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off16_field = {0, 16, OPERAND_OFFSET, true};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {off16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetOff16(uint32_t data);
-  static uint32_t SetOff16(uint16_t off16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetOff16(const uint32_t data) {
+    return off16_field.Get(data);
+  }
+  static constexpr uint32_t SetOff16(const uint16_t off16) {
+    return opcode | off16_field.Set(off16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class BarOff16ArnArmEq final : public Instruction4Byte {
  public:
-  BarOff16ArnArmEq() : Instruction4Byte() {}
+  constexpr BarOff16ArnArmEq() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::BAR_OFF16_ARN_ARM_EQ;
@@ -1571,6 +2046,8 @@ class BarOff16ArnArmEq final : public Instruction4Byte {
   static constexpr auto op_name = "bar";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -1580,31 +2057,49 @@ class BarOff16ArnArmEq final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off16_field = {0, 16, OPERAND_OFFSET, true};
+  static constexpr Field reg_n_field = {19, 3, OPERAND_REGISTER};
+  static constexpr Field reg_m_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {off16_field, reg_n_field, reg_m_field};
+
   /* Helper Functions */
-  static uint16_t GetOff16(uint32_t data);
-  static uint32_t SetOff16(uint16_t off16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
-  static uint8_t GetRegM(uint32_t data);
-  static uint32_t SetRegM(uint8_t m);
+  static constexpr uint16_t GetOff16(const uint32_t data) {
+    return off16_field.Get(data);
+  }
+  static constexpr uint32_t SetOff16(const uint16_t off16) {
+    return opcode | off16_field.Set(off16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
+  static constexpr uint8_t GetRegM(const uint32_t data) {
+    return reg_m_field.Get(data);
+  }
+  static constexpr uint32_t SetRegM(const uint8_t m) {
+    return opcode | reg_m_field.Set(m);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class BarOff16ArnArmNeq final : public Instruction4Byte {
  public:
-  BarOff16ArnArmNeq() : Instruction4Byte() {}
+  constexpr BarOff16ArnArmNeq() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::BAR_OFF16_ARN_ARM_NEQ;
@@ -1613,6 +2108,8 @@ class BarOff16ArnArmNeq final : public Instruction4Byte {
   static constexpr auto op_name = "bar";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -1622,31 +2119,49 @@ class BarOff16ArnArmNeq final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off16_field = {0, 16, OPERAND_OFFSET, true};
+  static constexpr Field reg_n_field = {19, 3, OPERAND_REGISTER};
+  static constexpr Field reg_m_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {off16_field, reg_n_field, reg_m_field};
+
   /* Helper Functions */
-  static uint16_t GetOff16(uint32_t data);
-  static uint32_t SetOff16(uint16_t off16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
-  static uint8_t GetRegM(uint32_t data);
-  static uint32_t SetRegM(uint8_t m);
+  static constexpr uint16_t GetOff16(const uint32_t data) {
+    return off16_field.Get(data);
+  }
+  static constexpr uint32_t SetOff16(const uint16_t off16) {
+    return opcode | off16_field.Set(off16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
+  static constexpr uint8_t GetRegM(const uint32_t data) {
+    return reg_m_field.Get(data);
+  }
+  static constexpr uint32_t SetRegM(const uint8_t m) {
+    return opcode | reg_m_field.Set(m);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class BfOff16Cond final : public Instruction4Byte {
  public:
-  BfOff16Cond() : Instruction4Byte() {}
+  constexpr BfOff16Cond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::BF_OFF16_COND;
@@ -1655,6 +2170,8 @@ class BfOff16Cond final : public Instruction4Byte {
   static constexpr auto op_name = "b";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -1664,29 +2181,42 @@ class BfOff16Cond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off16_field = {0, 16, OPERAND_OFFSET, true};
+  static constexpr Field cond_field = {16, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {off16_field, cond_field};
+
   /* Helper Functions */
-  static uint16_t GetOff16(uint32_t data);
-  static uint32_t SetOff16(uint16_t off16);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint16_t GetOff16(const uint32_t data) {
+    return off16_field.Get(data);
+  }
+  static constexpr uint32_t SetOff16(const uint16_t off16) {
+    return opcode | off16_field.Set(off16);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ClrcAmode final : public Instruction2Byte {
  public:
-  ClrcAmode() : Instruction2Byte() {}
+  constexpr ClrcAmode() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CLRC_AMODE;
@@ -1705,18 +2235,18 @@ class ClrcAmode final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ClrcM0M1Map final : public Instruction2Byte {
  public:
-  ClrcM0M1Map() : Instruction2Byte() {}
+  constexpr ClrcM0M1Map() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CLRC_M0M1MAP;
@@ -1735,18 +2265,18 @@ class ClrcM0M1Map final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ClrcObjmode final : public Instruction2Byte {
  public:
-  ClrcObjmode() : Instruction2Byte() {}
+  constexpr ClrcObjmode() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CLRC_OBJMODE;
@@ -1765,18 +2295,18 @@ class ClrcObjmode final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ClrcOvc final : public Instruction2Byte {
  public:
-  ClrcOvc() : Instruction2Byte() {}
+  constexpr ClrcOvc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CLRC_OVC;
@@ -1795,18 +2325,18 @@ class ClrcOvc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ClrcXf final : public Instruction2Byte {
  public:
-  ClrcXf() : Instruction2Byte() {}
+  constexpr ClrcXf() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CLRC_XF;
@@ -1825,18 +2355,18 @@ class ClrcXf final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ClrcMode final : public Instruction2Byte {
  public:
-  ClrcMode() : Instruction2Byte() {}
+  constexpr ClrcMode() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CLRC_MODE;
@@ -1854,23 +2384,31 @@ class ClrcMode final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field mode_field = {0, 8, OPERAND_MODE};
+  static constexpr std::array fields = {mode_field};
+
   /* Helper Functions */
-  static uint8_t GetMode(uint32_t data);
-  static uint32_t SetMode(uint8_t mode);
+  static constexpr uint8_t GetMode(const uint32_t data) {
+    return mode_field.Get(data);
+  }
+  static constexpr uint32_t SetMode(const uint8_t mode) {
+    return opcode | mode_field.Set(mode);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class CmpAxLoc16 final : public Instruction2Byte {
  public:
-  CmpAxLoc16() : Instruction2Byte() {}
+  constexpr CmpAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMP_AX_LOC15;
@@ -1888,25 +2426,38 @@ class CmpAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class CmpLoc16Const16 final : public Instruction4Byte {
  public:
-  CmpLoc16Const16() : Instruction4Byte() {}
+  constexpr CmpLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMP_LOC16_CONST16;
@@ -1924,25 +2475,38 @@ class CmpLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmp64AccP final : public Instruction2Byte {
  public:
-  Cmp64AccP() : Instruction2Byte() {}
+  constexpr Cmp64AccP() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMP64_ACC_P;
@@ -1961,18 +2525,18 @@ class Cmp64AccP final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class CmpbAxConst8 final : public Instruction2Byte {
  public:
-  CmpbAxConst8() : Instruction2Byte() {}
+  constexpr CmpbAxConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPB_AX_CONST8;
@@ -1990,25 +2554,38 @@ class CmpbAxConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, const8_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class CmplAccLoc32 final : public Instruction2Byte {
  public:
-  CmplAccLoc32() : Instruction2Byte() {}
+  constexpr CmplAccLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPL_ACC_LOC32;
@@ -2026,23 +2603,31 @@ class CmplAccLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class CmplAccPShiftPm final : public Instruction2Byte {
  public:
-  CmplAccPShiftPm() : Instruction2Byte() {}
+  constexpr CmplAccPShiftPm() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPL_ACC_P_SHIFT_PM;
@@ -2061,18 +2646,18 @@ class CmplAccPShiftPm final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpr0 final : public Instruction2Byte {
  public:
-  Cmpr0() : Instruction2Byte() {}
+  constexpr Cmpr0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPR_0;
@@ -2091,18 +2676,18 @@ class Cmpr0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpr1 final : public Instruction2Byte {
  public:
-  Cmpr1() : Instruction2Byte() {}
+  constexpr Cmpr1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPR_1;
@@ -2121,18 +2706,18 @@ class Cmpr1 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpr2 final : public Instruction2Byte {
  public:
-  Cmpr2() : Instruction2Byte() {}
+  constexpr Cmpr2() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPR_2;
@@ -2151,18 +2736,18 @@ class Cmpr2 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpr3 final : public Instruction2Byte {
  public:
-  Cmpr3() : Instruction2Byte() {}
+  constexpr Cmpr3() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPR_3;
@@ -2181,18 +2766,18 @@ class Cmpr3 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class CsbAcc final : public Instruction2Byte {
  public:
-  CsbAcc() : Instruction2Byte() {}
+  constexpr CsbAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CSB_ACC;
@@ -2211,18 +2796,18 @@ class CsbAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class DecLoc16 final : public Instruction2Byte {
  public:
-  DecLoc16() : Instruction2Byte() {}
+  constexpr DecLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::DEC_LOC16;
@@ -2240,23 +2825,31 @@ class DecLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class DmacAccPLoc32Xar7 final : public Instruction4Byte {
  public:
-  DmacAccPLoc32Xar7() : Instruction4Byte() {}
+  constexpr DmacAccPLoc32Xar7() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::DMAC_ACCC_P_LOC32_XAR7;
@@ -2274,23 +2867,31 @@ class DmacAccPLoc32Xar7 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class DmacAccPLoc32Xar7Postinc final : public Instruction4Byte {
  public:
-  DmacAccPLoc32Xar7Postinc() : Instruction4Byte() {}
+  constexpr DmacAccPLoc32Xar7Postinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::DMAC_ACCC_P_LOC32_XAR7_POSTINC;
@@ -2308,23 +2909,31 @@ class DmacAccPLoc32Xar7Postinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class DmovLoc16 final : public Instruction2Byte {
  public:
-  DmovLoc16() : Instruction2Byte() {}
+  constexpr DmovLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::DMOV_LOC16;
@@ -2342,23 +2951,31 @@ class DmovLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Eallow final : public Instruction2Byte {
  public:
-  Eallow() : Instruction2Byte() {}
+  constexpr Eallow() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::EALLOW;
@@ -2377,18 +2994,18 @@ class Eallow final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Edis final : public Instruction2Byte {
  public:
-  Edis() : Instruction2Byte() {}
+  constexpr Edis() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::EDIS;
@@ -2407,18 +3024,18 @@ class Edis final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Estop0 final : public Instruction2Byte {
  public:
-  Estop0() : Instruction2Byte() {}
+  constexpr Estop0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ESTOP0;
@@ -2437,18 +3054,18 @@ class Estop0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Estop1 final : public Instruction2Byte {
  public:
-  Estop1() : Instruction2Byte() {}
+  constexpr Estop1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ESTOP1;
@@ -2467,18 +3084,18 @@ class Estop1 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class FfcXar7Const22 final : public Instruction4Byte {
  public:
-  FfcXar7Const22() : Instruction4Byte() {}
+  constexpr FfcXar7Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::FFC_XAR7_CONST22;
@@ -2487,6 +3104,7 @@ class FfcXar7Const22 final : public Instruction4Byte {
   static constexpr auto op_name = "ffc";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CALL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -2496,27 +3114,35 @@ class FfcXar7Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class FlipAx final : public Instruction2Byte {
  public:
-  FlipAx() : Instruction2Byte() {}
+  constexpr FlipAx() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::FLIP_AX;
@@ -2534,23 +3160,31 @@ class FlipAx final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class IackConst16 final : public Instruction4Byte {
  public:
-  IackConst16() : Instruction4Byte() {}
+  constexpr IackConst16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IACK_CONST16;
@@ -2568,23 +3202,31 @@ class IackConst16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Idle final : public Instruction2Byte {
  public:
-  Idle() : Instruction2Byte() {}
+  constexpr Idle() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IDLE;
@@ -2603,18 +3245,18 @@ class Idle final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImaclPLoc32Xar7 final : public Instruction4Byte {
  public:
-  ImaclPLoc32Xar7() : Instruction4Byte() {}
+  constexpr ImaclPLoc32Xar7() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMACL_P_LOC32_XAR7;
@@ -2632,23 +3274,31 @@ class ImaclPLoc32Xar7 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImaclPLoc32Xar7Postinc final : public Instruction4Byte {
  public:
-  ImaclPLoc32Xar7Postinc() : Instruction4Byte() {}
+  constexpr ImaclPLoc32Xar7Postinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMACL_P_LOC32_XAR7_POSTINC;
@@ -2666,23 +3316,31 @@ class ImaclPLoc32Xar7Postinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImpyalPXtLoc32 final : public Instruction4Byte {
  public:
-  ImpyalPXtLoc32() : Instruction4Byte() {}
+  constexpr ImpyalPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMPYAL_P_XT_LOC32;
@@ -2700,23 +3358,31 @@ class ImpyalPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImpylAccXtLoc32 final : public Instruction4Byte {
  public:
-  ImpylAccXtLoc32() : Instruction4Byte() {}
+  constexpr ImpylAccXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMPYL_ACC_XT_LOC32;
@@ -2734,23 +3400,31 @@ class ImpylAccXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImpylPXtLoc32 final : public Instruction4Byte {
  public:
-  ImpylPXtLoc32() : Instruction4Byte() {}
+  constexpr ImpylPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMPYL_P_XT_LOC32;
@@ -2768,23 +3442,31 @@ class ImpylPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImpyslPXtLoc32 final : public Instruction4Byte {
  public:
-  ImpyslPXtLoc32() : Instruction4Byte() {}
+  constexpr ImpyslPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMPYSL_P_XT_LOC32;
@@ -2802,23 +3484,31 @@ class ImpyslPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ImpyxulPXtLoc32 final : public Instruction4Byte {
  public:
-  ImpyxulPXtLoc32() : Instruction4Byte() {}
+  constexpr ImpyxulPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IMPYXUL_P_XT_LOC32;
@@ -2836,23 +3526,31 @@ class ImpyxulPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class InLoc16Pa final : public Instruction4Byte {
  public:
-  InLoc16Pa() : Instruction4Byte() {}
+  constexpr InLoc16Pa() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IN_LOC16_PA;
@@ -2870,25 +3568,38 @@ class InLoc16Pa final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class IncLoc16 final : public Instruction2Byte {
  public:
-  IncLoc16() : Instruction2Byte() {}
+  constexpr IncLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::INC_LOC16;
@@ -2906,23 +3617,31 @@ class IncLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class IntrIntx final : public Instruction2Byte {
  public:
-  IntrIntx() : Instruction2Byte() {}
+  constexpr IntrIntx() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::INTR_INTX;
@@ -2931,6 +3650,7 @@ class IntrIntx final : public Instruction2Byte {
   static constexpr auto op_name = "intr";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_EXCEPTION;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -2940,26 +3660,34 @@ class IntrIntx final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field intr_x_field = {0, 4, OPERAND_CONSTANT};
+  static constexpr std::array fields = {intr_x_field};
+
   /* Helper Functions */
-  static uint8_t GetIntrX(uint32_t data);
-  static uint32_t SetIntrX(uint8_t x);
+  static constexpr uint8_t GetIntrX(const uint32_t data) {
+    return intr_x_field.Get(data);
+  }
+  static constexpr uint32_t SetIntrX(const uint8_t x) {
+    return opcode | intr_x_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class IntrNmi final : public Instruction2Byte {
  public:
-  IntrNmi() : Instruction2Byte() {}
+  constexpr IntrNmi() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::INTR_NMI;
@@ -2968,6 +3696,7 @@ class IntrNmi final : public Instruction2Byte {
   static constexpr auto op_name = "intr nmi";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_EXCEPTION;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -2978,21 +3707,21 @@ class IntrNmi final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class IntrEmuint final : public Instruction2Byte {
  public:
-  IntrEmuint() : Instruction2Byte() {}
+  constexpr IntrEmuint() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::INTR_EMUINT;
@@ -3001,6 +3730,7 @@ class IntrEmuint final : public Instruction2Byte {
   static constexpr auto op_name = "intr emuint";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_EXCEPTION;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3011,21 +3741,21 @@ class IntrEmuint final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Iret final : public Instruction2Byte {
  public:
-  Iret() : Instruction2Byte() {}
+  constexpr Iret() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::IRET;
@@ -3034,6 +3764,7 @@ class Iret final : public Instruction2Byte {
   static constexpr auto op_name = "iret";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_RETURN;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3044,21 +3775,21 @@ class Iret final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LbXar7 final : public Instruction2Byte {
  public:
-  LbXar7() : Instruction2Byte() {}
+  constexpr LbXar7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LB_XAR7;
@@ -3067,6 +3798,7 @@ class LbXar7 final : public Instruction2Byte {
   static constexpr auto op_name = "lb";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_INDIRECT;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3077,21 +3809,21 @@ class LbXar7 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LbConst22 final : public Instruction4Byte {
  public:
-  LbConst22() : Instruction4Byte() {}
+  constexpr LbConst22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LB_CONST22;
@@ -3100,6 +3832,7 @@ class LbConst22 final : public Instruction4Byte {
   static constexpr auto op_name = "lb";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_UNCONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3109,27 +3842,35 @@ class LbConst22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LcXar7 final : public Instruction2Byte {
  public:
-  LcXar7() : Instruction2Byte() {}
+  constexpr LcXar7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LC_XAR7;
@@ -3138,6 +3879,7 @@ class LcXar7 final : public Instruction2Byte {
   static constexpr auto op_name = "lc";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_INDIRECT;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3148,21 +3890,21 @@ class LcXar7 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LcConst22 final : public Instruction4Byte {
  public:
-  LcConst22() : Instruction4Byte() {}
+  constexpr LcConst22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LC_CONST22;
@@ -3171,6 +3913,7 @@ class LcConst22 final : public Instruction4Byte {
   static constexpr auto op_name = "lc";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CALL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3180,27 +3923,35 @@ class LcConst22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LcrConst22 final : public Instruction4Byte {
  public:
-  LcrConst22() : Instruction4Byte() {}
+  constexpr LcrConst22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LCR_CONST22;
@@ -3209,6 +3960,7 @@ class LcrConst22 final : public Instruction4Byte {
   static constexpr auto op_name = "lcr";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CALL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3218,27 +3970,35 @@ class LcrConst22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LcrXarn final : public Instruction2Byte {
  public:
-  LcrXarn() : Instruction2Byte() {}
+  constexpr LcrXarn() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LCR_XARN;
@@ -3247,6 +4007,7 @@ class LcrXarn final : public Instruction2Byte {
   static constexpr auto op_name = "lcr";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_INDIRECT;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3256,26 +4017,34 @@ class LcrXarn final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_n_field = {0, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_n_field};
+
   /* Helper Functions */
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LoopnzLoc16Const16 final : public Instruction4Byte {
  public:
-  LoopnzLoc16Const16() : Instruction4Byte() {}
+  constexpr LoopnzLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LOOPNZ_LOC16_CONST16;
@@ -3284,6 +4053,8 @@ class LoopnzLoc16Const16 final : public Instruction4Byte {
   static constexpr auto op_name = "loopnz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3293,28 +4064,42 @@ class LoopnzLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LoopzLoc16Const16 final : public Instruction4Byte {
  public:
-  LoopzLoc16Const16() : Instruction4Byte() {}
+  constexpr LoopzLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LOOPZ_LOC16_CONST16;
@@ -3323,6 +4108,8 @@ class LoopzLoc16Const16 final : public Instruction4Byte {
   static constexpr auto op_name = "loopz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3332,28 +4119,42 @@ class LoopzLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lpaddr final : public Instruction2Byte {
  public:
-  Lpaddr() : Instruction2Byte() {}
+  constexpr Lpaddr() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LPADDR;
@@ -3372,18 +4173,18 @@ class Lpaddr final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lret final : public Instruction2Byte {
  public:
-  Lret() : Instruction2Byte() {}
+  constexpr Lret() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LRET;
@@ -3392,6 +4193,7 @@ class Lret final : public Instruction2Byte {
   static constexpr auto op_name = "lret";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_RETURN;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3402,21 +4204,21 @@ class Lret final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lrete final : public Instruction2Byte {
  public:
-  Lrete() : Instruction2Byte() {}
+  constexpr Lrete() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LRETE;
@@ -3425,6 +4227,7 @@ class Lrete final : public Instruction2Byte {
   static constexpr auto op_name = "lrete";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_RETURN;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3435,21 +4238,21 @@ class Lrete final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lretr final : public Instruction2Byte {
  public:
-  Lretr() : Instruction2Byte() {}
+  constexpr Lretr() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LRETR;
@@ -3458,6 +4261,7 @@ class Lretr final : public Instruction2Byte {
   static constexpr auto op_name = "lretr";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_RETURN;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -3468,21 +4272,21 @@ class Lretr final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LslAccShift final : public Instruction2Byte {
  public:
-  LslAccShift() : Instruction2Byte() {}
+  constexpr LslAccShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSL_ACC_SHIFT;
@@ -3500,23 +4304,31 @@ class LslAccShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {shift_field};
+
   /* Helper functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LslAccT final : public Instruction2Byte {
  public:
-  LslAccT() : Instruction2Byte() {}
+  constexpr LslAccT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSL_ACC_T;
@@ -3535,18 +4347,18 @@ class LslAccT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LslAxShift final : public Instruction2Byte {
  public:
-  LslAxShift() : Instruction2Byte() {}
+  constexpr LslAxShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSL_AX_SHIFT;
@@ -3564,25 +4376,38 @@ class LslAxShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {4, 1, OPERAND_REGISTER};
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {reg_ax_field, shift_field};
+
   /* Helper functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LslAxT final : public Instruction2Byte {
  public:
-  LslAxT() : Instruction2Byte() {}
+  constexpr LslAxT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSL_AX_T;
@@ -3600,23 +4425,31 @@ class LslAxT final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lsl64AccPShift final : public Instruction2Byte {
  public:
-  Lsl64AccPShift() : Instruction2Byte() {}
+  constexpr Lsl64AccPShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSL64_ACC_P_SHIFT;
@@ -3634,23 +4467,31 @@ class Lsl64AccPShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {shift_field};
+
   /* Helper functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lsl64AccPT final : public Instruction2Byte {
  public:
-  Lsl64AccPT() : Instruction2Byte() {}
+  constexpr Lsl64AccPT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSL64_ACC_P_T;
@@ -3669,18 +4510,18 @@ class Lsl64AccPT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LsllAccT final : public Instruction2Byte {
  public:
-  LsllAccT() : Instruction2Byte() {}
+  constexpr LsllAccT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSLL_ACC_T;
@@ -3699,18 +4540,18 @@ class LsllAccT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LsrAxShift final : public Instruction2Byte {
  public:
-  LsrAxShift() : Instruction2Byte() {}
+  constexpr LsrAxShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSR_AX_SHIFT;
@@ -3728,25 +4569,38 @@ class LsrAxShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {4, 1, OPERAND_REGISTER};
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {reg_ax_field, shift_field};
+
   /* Helper functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LsrAxT final : public Instruction2Byte {
  public:
-  LsrAxT() : Instruction2Byte() {}
+  constexpr LsrAxT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSR_AX_T;
@@ -3764,23 +4618,31 @@ class LsrAxT final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lsr64AccPShift final : public Instruction2Byte {
  public:
-  Lsr64AccPShift() : Instruction2Byte() {}
+  constexpr Lsr64AccPShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSR64_ACC_P_SHIFT;
@@ -3798,23 +4660,31 @@ class Lsr64AccPShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {shift_field};
+
   /* Helper functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Lsr64AccPT final : public Instruction2Byte {
  public:
-  Lsr64AccPT() : Instruction2Byte() {}
+  constexpr Lsr64AccPT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSR64_ACC_P_T;
@@ -3833,18 +4703,18 @@ class Lsr64AccPT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class LsrlAccT final : public Instruction2Byte {
  public:
-  LsrlAccT() : Instruction2Byte() {}
+  constexpr LsrlAccT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::LSRL_ACC_T;
@@ -3863,18 +4733,18 @@ class LsrlAccT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MacPLoc16Pma final : public Instruction4Byte {
  public:
-  MacPLoc16Pma() : Instruction4Byte() {}
+  constexpr MacPLoc16Pma() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAC_P_LOC16_PMA;
@@ -3892,25 +4762,38 @@ class MacPLoc16Pma final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MacPLoc16Xar7 final : public Instruction4Byte {
  public:
-  MacPLoc16Xar7() : Instruction4Byte() {}
+  constexpr MacPLoc16Xar7() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAC_P_LOC16_XAR7;
@@ -3928,23 +4811,31 @@ class MacPLoc16Xar7 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MacPLoc16Xar7Postinc final : public Instruction4Byte {
  public:
-  MacPLoc16Xar7Postinc() : Instruction4Byte() {}
+  constexpr MacPLoc16Xar7Postinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAC_P_LOC16_XAR7_POSTINC;
@@ -3962,23 +4853,31 @@ class MacPLoc16Xar7Postinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MaxAxLoc16 final : public Instruction4Byte {
  public:
-  MaxAxLoc16() : Instruction4Byte() {}
+  constexpr MaxAxLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAX_AX_LOC16;
@@ -3996,25 +4895,38 @@ class MaxAxLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {16, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MaxculPLoc32 final : public Instruction4Byte {
  public:
-  MaxculPLoc32() : Instruction4Byte() {}
+  constexpr MaxculPLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAXCUL_P_LOC32;
@@ -4032,23 +4944,31 @@ class MaxculPLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MaxlAccLoc32 final : public Instruction4Byte {
  public:
-  MaxlAccLoc32() : Instruction4Byte() {}
+  constexpr MaxlAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAXL_ACC_LOC32;
@@ -4066,23 +4986,31 @@ class MaxlAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MinAxLoc16 final : public Instruction4Byte {
  public:
-  MinAxLoc16() : Instruction4Byte() {}
+  constexpr MinAxLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MIN_AX_LOC16;
@@ -4100,25 +5028,38 @@ class MinAxLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {16, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MinculPLoc32 final : public Instruction4Byte {
  public:
-  MinculPLoc32() : Instruction4Byte() {}
+  constexpr MinculPLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MINCUL_P_LOC32;
@@ -4136,23 +5077,31 @@ class MinculPLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MinlAccLoc32 final : public Instruction4Byte {
  public:
-  MinlAccLoc32() : Instruction4Byte() {}
+  constexpr MinlAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MINL_ACC_LOC32;
@@ -4170,23 +5119,31 @@ class MinlAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovMem16Loc16 final : public Instruction4Byte {
  public:
-  MovMem16Loc16() : Instruction4Byte() {}
+  constexpr MovMem16Loc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_MEM16_LOC16;
@@ -4204,25 +5161,38 @@ class MovMem16Loc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {const16_field, loc16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccConst16Shift final : public Instruction4Byte {
  public:
-  MovAccConst16Shift() : Instruction4Byte() {}
+  constexpr MovAccConst16Shift() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_CONST16_SHIFT;
@@ -4240,25 +5210,38 @@ class MovAccConst16Shift final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field shift_field = {16, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {const16_field, shift_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccLoc16ShiftT final : public Instruction4Byte {
  public:
-  MovAccLoc16ShiftT() : Instruction4Byte() {}
+  constexpr MovAccLoc16ShiftT() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_LOC16_SHIFT_T;
@@ -4276,23 +5259,31 @@ class MovAccLoc16ShiftT final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccLoc16Objmode1 final : public Instruction2Byte {
  public:
-  MovAccLoc16Objmode1() : Instruction2Byte() {}
+  constexpr MovAccLoc16Objmode1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_LOC16_OBJMDOE1;
@@ -4310,23 +5301,31 @@ class MovAccLoc16Objmode1 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccLoc16Objmode0 final : public Instruction2Byte {
  public:
-  MovAccLoc16Objmode0() : Instruction2Byte() {}
+  constexpr MovAccLoc16Objmode0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_LOC16_OBJMDOE0;
@@ -4344,23 +5343,31 @@ class MovAccLoc16Objmode0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccLoc16Shift1_15Objmode1 final : public Instruction4Byte {
  public:
-  MovAccLoc16Shift1_15Objmode1() : Instruction4Byte() {}
+  constexpr MovAccLoc16Shift1_15Objmode1() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_LOC16_SHIFT1_15_OBJMODE1;
@@ -4378,25 +5385,38 @@ class MovAccLoc16Shift1_15Objmode1 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field shift_field = {8, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {loc16_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccLoc16Shift1_15Objmode0 final : public Instruction2Byte {
  public:
-  MovAccLoc16Shift1_15Objmode0() : Instruction2Byte() {}
+  constexpr MovAccLoc16Shift1_15Objmode0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_LOC16_SHIFT1_15_OBJMODE0;
@@ -4414,25 +5434,38 @@ class MovAccLoc16Shift1_15Objmode0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field shift_field = {8, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {loc16_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAccLoc16Shift16 final : public Instruction2Byte {
  public:
-  MovAccLoc16Shift16() : Instruction2Byte() {}
+  constexpr MovAccLoc16Shift16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_ACC_LOC16_SHIFT16;
@@ -4450,23 +5483,31 @@ class MovAccLoc16Shift16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAr6Loc16 final : public Instruction2Byte {
  public:
-  MovAr6Loc16() : Instruction2Byte() {}
+  constexpr MovAr6Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_AR6_LOC16;
@@ -4484,23 +5525,31 @@ class MovAr6Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAr7Loc16 final : public Instruction2Byte {
  public:
-  MovAr7Loc16() : Instruction2Byte() {}
+  constexpr MovAr7Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_AR7_LOC16;
@@ -4518,23 +5567,31 @@ class MovAr7Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovAxLoc16 final : public Instruction2Byte {
  public:
-  MovAxLoc16() : Instruction2Byte() {}
+  constexpr MovAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_AX_LOC16;
@@ -4552,25 +5609,38 @@ class MovAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovDpConst10 final : public Instruction2Byte {
  public:
-  MovDpConst10() : Instruction2Byte() {}
+  constexpr MovDpConst10() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_DP_CONST10;
@@ -4588,23 +5658,31 @@ class MovDpConst10 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const10_field = {0, 10, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const10_field};
+
   /* Helper Functions */
-  static uint16_t GetConst10(uint32_t data);
-  static uint32_t SetConst10(uint16_t const10);
+  static constexpr uint16_t GetConst10(const uint32_t data) {
+    return const10_field.Get(data);
+  }
+  static constexpr uint32_t SetConst10(const uint16_t const10) {
+    return opcode | const10_field.Set(const10);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovIerLoc16 final : public Instruction2Byte {
  public:
-  MovIerLoc16() : Instruction2Byte() {}
+  constexpr MovIerLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_IER_LOC16;
@@ -4622,23 +5700,31 @@ class MovIerLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16Const16 final : public Instruction4Byte {
  public:
-  MovLoc16Const16() : Instruction4Byte() {}
+  constexpr MovLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_CONST16;
@@ -4656,25 +5742,38 @@ class MovLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16Mem16 final : public Instruction4Byte {
  public:
-  MovLoc16Mem16() : Instruction4Byte() {}
+  constexpr MovLoc16Mem16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_MEM16;
@@ -4692,25 +5791,38 @@ class MovLoc16Mem16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16_0 final : public Instruction2Byte {
  public:
-  MovLoc16_0() : Instruction2Byte() {}
+  constexpr MovLoc16_0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_0;
@@ -4728,23 +5840,31 @@ class MovLoc16_0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16AccShift1 final : public Instruction2Byte {
  public:
-  MovLoc16AccShift1() : Instruction2Byte() {}
+  constexpr MovLoc16AccShift1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_ACC_SHIFT1;
@@ -4762,23 +5882,31 @@ class MovLoc16AccShift1 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16AccShift2_8Objmode1 final : public Instruction4Byte {
  public:
-  MovLoc16AccShift2_8Objmode1() : Instruction4Byte() {}
+  constexpr MovLoc16AccShift2_8Objmode1() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_ACC_SHIFT2_8_OBJMODE_1;
@@ -4796,25 +5924,38 @@ class MovLoc16AccShift2_8Objmode1 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field shift_field = {8, 3, OPERAND_SHIFT};
+  static constexpr std::array fields = {loc16_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16AccShift2_8Objmode0 final : public Instruction2Byte {
  public:
-  MovLoc16AccShift2_8Objmode0() : Instruction2Byte() {}
+  constexpr MovLoc16AccShift2_8Objmode0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_ACC_SHIFT2_8_OBJMODE_0;
@@ -4832,25 +5973,38 @@ class MovLoc16AccShift2_8Objmode0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field shift_field = {8, 3, OPERAND_SHIFT};
+  static constexpr std::array fields = {loc16_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16Arn final : public Instruction2Byte {
  public:
-  MovLoc16Arn() : Instruction2Byte() {}
+  constexpr MovLoc16Arn() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_ARN;
@@ -4868,25 +6022,38 @@ class MovLoc16Arn final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_n_field = {8, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {loc16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16Ax final : public Instruction2Byte {
  public:
-  MovLoc16Ax() : Instruction2Byte() {}
+  constexpr MovLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_AX;
@@ -4904,25 +6071,38 @@ class MovLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {loc16_field, reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16AxCond final : public Instruction4Byte {
  public:
-  MovLoc16AxCond() : Instruction4Byte() {}
+  constexpr MovLoc16AxCond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_AX_COND;
@@ -4940,27 +6120,45 @@ class MovLoc16AxCond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_ax_field = {16, 1, OPERAND_REGISTER};
+  static constexpr Field cond_field = {8, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {loc16_field, reg_ax_field, cond_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16Ier final : public Instruction2Byte {
  public:
-  MovLoc16Ier() : Instruction2Byte() {}
+  constexpr MovLoc16Ier() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_IER;
@@ -4978,23 +6176,31 @@ class MovLoc16Ier final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16Ovc final : public Instruction4Byte {
  public:
-  MovLoc16Ovc() : Instruction4Byte() {}
+  constexpr MovLoc16Ovc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_OVC;
@@ -5012,23 +6218,31 @@ class MovLoc16Ovc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16P final : public Instruction2Byte {
  public:
-  MovLoc16P() : Instruction2Byte() {}
+  constexpr MovLoc16P() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_P;
@@ -5046,23 +6260,31 @@ class MovLoc16P final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovLoc16T final : public Instruction2Byte {
  public:
-  MovLoc16T() : Instruction2Byte() {}
+  constexpr MovLoc16T() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_LOC16_T;
@@ -5080,23 +6302,31 @@ class MovLoc16T final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovOvcLoc16 final : public Instruction4Byte {
  public:
-  MovOvcLoc16() : Instruction4Byte() {}
+  constexpr MovOvcLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_OVC_LOC16;
@@ -5114,23 +6344,31 @@ class MovOvcLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovPhLoc16 final : public Instruction2Byte {
  public:
-  MovPhLoc16() : Instruction2Byte() {}
+  constexpr MovPhLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_PH_LOC16;
@@ -5148,23 +6386,31 @@ class MovPhLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovPlLoc16 final : public Instruction2Byte {
  public:
-  MovPlLoc16() : Instruction2Byte() {}
+  constexpr MovPlLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_PL_LOC16;
@@ -5182,23 +6428,31 @@ class MovPlLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovPmAx final : public Instruction2Byte {
  public:
-  MovPmAx() : Instruction2Byte() {}
+  constexpr MovPmAx() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_PM_AX;
@@ -5216,23 +6470,31 @@ class MovPmAx final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovTLoc16 final : public Instruction2Byte {
  public:
-  MovTLoc16() : Instruction2Byte() {}
+  constexpr MovTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_T_LOC16;
@@ -5250,23 +6512,31 @@ class MovTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovTl0 final : public Instruction2Byte {
  public:
-  MovTl0() : Instruction2Byte() {}
+  constexpr MovTl0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_TL_0;
@@ -5285,18 +6555,18 @@ class MovTl0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovXarnPc final : public Instruction2Byte {
  public:
-  MovXarnPc() : Instruction2Byte() {}
+  constexpr MovXarnPc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOV_XARN_PC;
@@ -5314,23 +6584,31 @@ class MovXarnPc final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_n_field = {0, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_n_field};
+
   /* Helper Functions */
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovaTLoc16 final : public Instruction2Byte {
  public:
-  MovaTLoc16() : Instruction2Byte() {}
+  constexpr MovaTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVA_T_LOC16;
@@ -5348,23 +6626,31 @@ class MovaTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovadTLoc16 final : public Instruction2Byte {
  public:
-  MovadTLoc16() : Instruction2Byte() {}
+  constexpr MovadTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVAD_T_LOC16;
@@ -5382,23 +6668,31 @@ class MovadTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbAccConst8 final : public Instruction2Byte {
  public:
-  MovbAccConst8() : Instruction2Byte() {}
+  constexpr MovbAccConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_ACC_CONST8;
@@ -5416,23 +6710,31 @@ class MovbAccConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbAr6Const8 final : public Instruction2Byte {
  public:
-  MovbAr6Const8() : Instruction2Byte() {}
+  constexpr MovbAr6Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_AR6_CONST8;
@@ -5450,23 +6752,31 @@ class MovbAr6Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbAr7Const8 final : public Instruction2Byte {
  public:
-  MovbAr7Const8() : Instruction2Byte() {}
+  constexpr MovbAr7Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_AR7_CONST8;
@@ -5484,23 +6794,31 @@ class MovbAr7Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbAxConst8 final : public Instruction2Byte {
  public:
-  MovbAxConst8() : Instruction2Byte() {}
+  constexpr MovbAxConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_AX_CONST8;
@@ -5518,25 +6836,38 @@ class MovbAxConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, const8_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbAxlsbLoc16 final : public Instruction2Byte {
  public:
-  MovbAxlsbLoc16() : Instruction2Byte() {}
+  constexpr MovbAxlsbLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_AXLSB_LOC16;
@@ -5554,25 +6885,38 @@ class MovbAxlsbLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbAxmsbLoc16 final : public Instruction2Byte {
  public:
-  MovbAxmsbLoc16() : Instruction2Byte() {}
+  constexpr MovbAxmsbLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_AXMSB_LOC16;
@@ -5590,25 +6934,38 @@ class MovbAxmsbLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbLoc16Const8Cond final : public Instruction4Byte {
  public:
-  MovbLoc16Const8Cond() : Instruction4Byte() {}
+  constexpr MovbLoc16Const8Cond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_LOC16_CONST8_COND;
@@ -5626,27 +6983,45 @@ class MovbLoc16Const8Cond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field const8_field = {8, 8, OPERAND_CONSTANT};
+  static constexpr Field cond_field = {16, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {loc16_field, const8_field, cond_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbLoc16Axlsb final : public Instruction2Byte {
  public:
-  MovbLoc16Axlsb() : Instruction2Byte() {}
+  constexpr MovbLoc16Axlsb() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_LOC16_AXLSB;
@@ -5664,25 +7039,38 @@ class MovbLoc16Axlsb final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbLoc16Axmsb final : public Instruction2Byte {
  public:
-  MovbLoc16Axmsb() : Instruction2Byte() {}
+  constexpr MovbLoc16Axmsb() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_LOC16_AXMSB;
@@ -5700,25 +7088,38 @@ class MovbLoc16Axmsb final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar0Const8 final : public Instruction2Byte {
  public:
-  MovbXar0Const8() : Instruction2Byte() {}
+  constexpr MovbXar0Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR0_CONST8;
@@ -5736,23 +7137,31 @@ class MovbXar0Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar1Const8 final : public Instruction2Byte {
  public:
-  MovbXar1Const8() : Instruction2Byte() {}
+  constexpr MovbXar1Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR1_CONST8;
@@ -5770,23 +7179,31 @@ class MovbXar1Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar2Const8 final : public Instruction2Byte {
  public:
-  MovbXar2Const8() : Instruction2Byte() {}
+  constexpr MovbXar2Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR2_CONST8;
@@ -5804,23 +7221,31 @@ class MovbXar2Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar3Const8 final : public Instruction2Byte {
  public:
-  MovbXar3Const8() : Instruction2Byte() {}
+  constexpr MovbXar3Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR3_CONST8;
@@ -5838,23 +7263,31 @@ class MovbXar3Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar4Const8 final : public Instruction2Byte {
  public:
-  MovbXar4Const8() : Instruction2Byte() {}
+  constexpr MovbXar4Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR4_CONST8;
@@ -5872,23 +7305,31 @@ class MovbXar4Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar5Const8 final : public Instruction2Byte {
  public:
-  MovbXar5Const8() : Instruction2Byte() {}
+  constexpr MovbXar5Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR5_CONST8;
@@ -5906,23 +7347,31 @@ class MovbXar5Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar6Const8 final : public Instruction2Byte {
  public:
-  MovbXar6Const8() : Instruction2Byte() {}
+  constexpr MovbXar6Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR6_CONST8;
@@ -5940,23 +7389,31 @@ class MovbXar6Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovbXar7Const8 final : public Instruction2Byte {
  public:
-  MovbXar7Const8() : Instruction2Byte() {}
+  constexpr MovbXar7Const8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVB_XAR7_CONST8;
@@ -5974,23 +7431,31 @@ class MovbXar7Const8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovdlXtLoc32 final : public Instruction2Byte {
  public:
-  MovdlXtLoc32() : Instruction2Byte() {}
+  constexpr MovdlXtLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVDL_XT_LOC32;
@@ -6008,23 +7473,31 @@ class MovdlXtLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovhLoc16AccShift1 final : public Instruction2Byte {
  public:
-  MovhLoc16AccShift1() : Instruction2Byte() {}
+  constexpr MovhLoc16AccShift1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVH_LOC16_ACC_SHIFT1;
@@ -6042,23 +7515,31 @@ class MovhLoc16AccShift1 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovhLoc16AccShift2_8Objmode1 final : public Instruction4Byte {
  public:
-  MovhLoc16AccShift2_8Objmode1() : Instruction4Byte() {}
+  constexpr MovhLoc16AccShift2_8Objmode1() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVH_LOC16_ACC_SHIFT2_8_OBJMODE_1;
@@ -6076,25 +7557,38 @@ class MovhLoc16AccShift2_8Objmode1 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field shift_field = {8, 3, OPERAND_SHIFT};
+  static constexpr std::array fields = {loc16_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovhLoc16AccShift2_8Objmode0 final : public Instruction2Byte {
  public:
-  MovhLoc16AccShift2_8Objmode0() : Instruction2Byte() {}
+  constexpr MovhLoc16AccShift2_8Objmode0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVH_LOC16_ACC_SHIFT2_8_OBJMODE_0;
@@ -6112,25 +7606,38 @@ class MovhLoc16AccShift2_8Objmode0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field shift_field = {8, 3, OPERAND_SHIFT};
+  static constexpr std::array fields = {loc16_field, shift_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovhLoc16P final : public Instruction2Byte {
  public:
-  MovhLoc16P() : Instruction2Byte() {}
+  constexpr MovhLoc16P() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVH_LOC16_P;
@@ -6148,23 +7655,31 @@ class MovhLoc16P final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlAccLoc32 final : public Instruction2Byte {
  public:
-  MovlAccLoc32() : Instruction2Byte() {}
+  constexpr MovlAccLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_ACC_LOC32;
@@ -6182,23 +7697,31 @@ class MovlAccLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlAccPShiftPm final : public Instruction2Byte {
  public:
-  MovlAccPShiftPm() : Instruction2Byte() {}
+  constexpr MovlAccPShiftPm() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_ACC_P_SHIFT_PM;
@@ -6217,18 +7740,18 @@ class MovlAccPShiftPm final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Acc final : public Instruction2Byte {
  public:
-  MovlLoc32Acc() : Instruction2Byte() {}
+  constexpr MovlLoc32Acc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_ACC;
@@ -6246,23 +7769,31 @@ class MovlLoc32Acc final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32AccCond final : public Instruction4Byte {
  public:
-  MovlLoc32AccCond() : Instruction4Byte() {}
+  constexpr MovlLoc32AccCond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_ACC_COND;
@@ -6280,25 +7811,38 @@ class MovlLoc32AccCond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr Field cond_field = {8, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {loc32_field, cond_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32P final : public Instruction2Byte {
  public:
-  MovlLoc32P() : Instruction2Byte() {}
+  constexpr MovlLoc32P() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_P;
@@ -6316,23 +7860,31 @@ class MovlLoc32P final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar0 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar0() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR0;
@@ -6350,23 +7902,31 @@ class MovlLoc32Xar0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar1 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar1() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR1;
@@ -6384,23 +7944,31 @@ class MovlLoc32Xar1 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar2 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar2() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar2() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR2;
@@ -6418,23 +7986,31 @@ class MovlLoc32Xar2 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar3 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar3() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar3() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR3;
@@ -6452,23 +8028,31 @@ class MovlLoc32Xar3 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar4 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar4() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar4() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR4;
@@ -6486,23 +8070,31 @@ class MovlLoc32Xar4 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar5 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar5() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar5() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR5;
@@ -6520,23 +8112,31 @@ class MovlLoc32Xar5 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar6 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar6() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar6() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR6;
@@ -6554,23 +8154,31 @@ class MovlLoc32Xar6 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xar7 final : public Instruction2Byte {
  public:
-  MovlLoc32Xar7() : Instruction2Byte() {}
+  constexpr MovlLoc32Xar7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XAR7;
@@ -6588,23 +8196,31 @@ class MovlLoc32Xar7 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlLoc32Xt final : public Instruction2Byte {
  public:
-  MovlLoc32Xt() : Instruction2Byte() {}
+  constexpr MovlLoc32Xt() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_LOC32_XT;
@@ -6622,23 +8238,31 @@ class MovlLoc32Xt final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlPAcc final : public Instruction2Byte {
  public:
-  MovlPAcc() : Instruction2Byte() {}
+  constexpr MovlPAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_P_ACC;
@@ -6657,18 +8281,18 @@ class MovlPAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlPLoc32 final : public Instruction2Byte {
  public:
-  MovlPLoc32() : Instruction2Byte() {}
+  constexpr MovlPLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_P_LOC32;
@@ -6686,23 +8310,31 @@ class MovlPLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar0Loc32 final : public Instruction2Byte {
  public:
-  MovlXar0Loc32() : Instruction2Byte() {}
+  constexpr MovlXar0Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR0_LOC32;
@@ -6720,23 +8352,31 @@ class MovlXar0Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar1Loc32 final : public Instruction2Byte {
  public:
-  MovlXar1Loc32() : Instruction2Byte() {}
+  constexpr MovlXar1Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR1_LOC32;
@@ -6754,23 +8394,31 @@ class MovlXar1Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar2Loc32 final : public Instruction2Byte {
  public:
-  MovlXar2Loc32() : Instruction2Byte() {}
+  constexpr MovlXar2Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR2_LOC32;
@@ -6788,23 +8436,31 @@ class MovlXar2Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar3Loc32 final : public Instruction2Byte {
  public:
-  MovlXar3Loc32() : Instruction2Byte() {}
+  constexpr MovlXar3Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR3_LOC32;
@@ -6822,23 +8478,31 @@ class MovlXar3Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar4Loc32 final : public Instruction2Byte {
  public:
-  MovlXar4Loc32() : Instruction2Byte() {}
+  constexpr MovlXar4Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR4_LOC32;
@@ -6856,23 +8520,31 @@ class MovlXar4Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar5Loc32 final : public Instruction2Byte {
  public:
-  MovlXar5Loc32() : Instruction2Byte() {}
+  constexpr MovlXar5Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR5_LOC32;
@@ -6890,23 +8562,31 @@ class MovlXar5Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar6Loc32 final : public Instruction2Byte {
  public:
-  MovlXar6Loc32() : Instruction2Byte() {}
+  constexpr MovlXar6Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR6_LOC32;
@@ -6924,23 +8604,31 @@ class MovlXar6Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar7Loc32 final : public Instruction2Byte {
  public:
-  MovlXar7Loc32() : Instruction2Byte() {}
+  constexpr MovlXar7Loc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR7_LOC32;
@@ -6958,23 +8646,31 @@ class MovlXar7Loc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar0Const22 final : public Instruction4Byte {
  public:
-  MovlXar0Const22() : Instruction4Byte() {}
+  constexpr MovlXar0Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR0_CONST22;
@@ -6992,23 +8688,31 @@ class MovlXar0Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar1Const22 final : public Instruction4Byte {
  public:
-  MovlXar1Const22() : Instruction4Byte() {}
+  constexpr MovlXar1Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR1_CONST22;
@@ -7026,23 +8730,31 @@ class MovlXar1Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar2Const22 final : public Instruction4Byte {
  public:
-  MovlXar2Const22() : Instruction4Byte() {}
+  constexpr MovlXar2Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR2_CONST22;
@@ -7060,23 +8772,31 @@ class MovlXar2Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar3Const22 final : public Instruction4Byte {
  public:
-  MovlXar3Const22() : Instruction4Byte() {}
+  constexpr MovlXar3Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR3_CONST22;
@@ -7094,23 +8814,31 @@ class MovlXar3Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar4Const22 final : public Instruction4Byte {
  public:
-  MovlXar4Const22() : Instruction4Byte() {}
+  constexpr MovlXar4Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR4_CONST22;
@@ -7128,23 +8856,31 @@ class MovlXar4Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar5Const22 final : public Instruction4Byte {
  public:
-  MovlXar5Const22() : Instruction4Byte() {}
+  constexpr MovlXar5Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR5_CONST22;
@@ -7162,23 +8898,31 @@ class MovlXar5Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar6Const22 final : public Instruction4Byte {
  public:
-  MovlXar6Const22() : Instruction4Byte() {}
+  constexpr MovlXar6Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR6_CONST22;
@@ -7196,23 +8940,31 @@ class MovlXar6Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXar7Const22 final : public Instruction4Byte {
  public:
-  MovlXar7Const22() : Instruction4Byte() {}
+  constexpr MovlXar7Const22() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XAR7_CONST22;
@@ -7230,23 +8982,31 @@ class MovlXar7Const22 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const22_field = {0, 22, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const22_field};
+
   /* Helper Functions */
-  static uint32_t GetConst22(uint32_t data);
-  static uint32_t SetConst22(uint32_t const22);
+  static constexpr uint32_t GetConst22(const uint32_t data) {
+    return const22_field.Get(data);
+  }
+  static constexpr uint32_t SetConst22(const uint32_t const22) {
+    return opcode | const22_field.Set(const22);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovlXtLoc32 final : public Instruction2Byte {
  public:
-  MovlXtLoc32() : Instruction2Byte() {}
+  constexpr MovlXtLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVL_XT_LOC32;
@@ -7264,23 +9024,31 @@ class MovlXtLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovpTLoc16 final : public Instruction2Byte {
  public:
-  MovpTLoc16() : Instruction2Byte() {}
+  constexpr MovpTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVP_T_LOC16;
@@ -7298,23 +9066,31 @@ class MovpTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovsTLoc16 final : public Instruction2Byte {
  public:
-  MovsTLoc16() : Instruction2Byte() {}
+  constexpr MovsTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVS_T_LOC16;
@@ -7332,23 +9108,31 @@ class MovsTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovuAccLoc16 final : public Instruction2Byte {
  public:
-  MovuAccLoc16() : Instruction2Byte() {}
+  constexpr MovuAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVU_ACC_LOC16;
@@ -7366,23 +9150,31 @@ class MovuAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovuLoc16Ovc final : public Instruction4Byte {
  public:
-  MovuLoc16Ovc() : Instruction4Byte() {}
+  constexpr MovuLoc16Ovc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVU_LOC16_OVC;
@@ -7400,23 +9192,31 @@ class MovuLoc16Ovc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovuOvcLoc16 final : public Instruction4Byte {
  public:
-  MovuOvcLoc16() : Instruction4Byte() {}
+  constexpr MovuOvcLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVU_OVC_LOC16;
@@ -7434,23 +9234,31 @@ class MovuOvcLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovwDpConst16 final : public Instruction4Byte {
  public:
-  MovwDpConst16() : Instruction4Byte() {}
+  constexpr MovwDpConst16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVW_DP_CONST16;
@@ -7468,23 +9276,31 @@ class MovwDpConst16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovxTlLoc16 final : public Instruction4Byte {
  public:
-  MovxTlLoc16() : Instruction4Byte() {}
+  constexpr MovxTlLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVX_TL_LOC16;
@@ -7502,23 +9318,31 @@ class MovxTlLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr0Loc16 final : public Instruction2Byte {
  public:
-  MovzAr0Loc16() : Instruction2Byte() {}
+  constexpr MovzAr0Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR0_LOC16;
@@ -7536,23 +9360,31 @@ class MovzAr0Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr1Loc16 final : public Instruction2Byte {
  public:
-  MovzAr1Loc16() : Instruction2Byte() {}
+  constexpr MovzAr1Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR1_LOC16;
@@ -7570,23 +9402,31 @@ class MovzAr1Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr2Loc16 final : public Instruction2Byte {
  public:
-  MovzAr2Loc16() : Instruction2Byte() {}
+  constexpr MovzAr2Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR2_LOC16;
@@ -7604,23 +9444,31 @@ class MovzAr2Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr3Loc16 final : public Instruction2Byte {
  public:
-  MovzAr3Loc16() : Instruction2Byte() {}
+  constexpr MovzAr3Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR3_LOC16;
@@ -7638,23 +9486,31 @@ class MovzAr3Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr4Loc16 final : public Instruction2Byte {
  public:
-  MovzAr4Loc16() : Instruction2Byte() {}
+  constexpr MovzAr4Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR4_LOC16;
@@ -7672,23 +9528,31 @@ class MovzAr4Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr5Loc16 final : public Instruction2Byte {
  public:
-  MovzAr5Loc16() : Instruction2Byte() {}
+  constexpr MovzAr5Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR5_LOC16;
@@ -7706,23 +9570,31 @@ class MovzAr5Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr6Loc16 final : public Instruction2Byte {
  public:
-  MovzAr6Loc16() : Instruction2Byte() {}
+  constexpr MovzAr6Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR6_LOC16;
@@ -7740,23 +9612,31 @@ class MovzAr6Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzAr7Loc16 final : public Instruction2Byte {
  public:
-  MovzAr7Loc16() : Instruction2Byte() {}
+  constexpr MovzAr7Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_AR7_LOC16;
@@ -7774,23 +9654,31 @@ class MovzAr7Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MovzDpConst10 final : public Instruction2Byte {
  public:
-  MovzDpConst10() : Instruction2Byte() {}
+  constexpr MovzDpConst10() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MOVZ_DP_CONST10;
@@ -7808,23 +9696,31 @@ class MovzDpConst10 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const10_field = {0, 10, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const10_field};
+
   /* Helper Functions */
-  static uint16_t GetConst10(uint32_t data);
-  static uint32_t SetConst10(uint16_t const10);
+  static constexpr uint16_t GetConst10(const uint32_t data) {
+    return const10_field.Get(data);
+  }
+  static constexpr uint32_t SetConst10(const uint16_t const10) {
+    return opcode | const10_field.Set(const10);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyAccLoc16Const16 final : public Instruction4Byte {
  public:
-  MpyAccLoc16Const16() : Instruction4Byte() {}
+  constexpr MpyAccLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPY_ACC_LOC16_CONST16;
@@ -7842,25 +9738,38 @@ class MpyAccLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyAccTLoc16 final : public Instruction2Byte {
  public:
-  MpyAccTLoc16() : Instruction2Byte() {}
+  constexpr MpyAccTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPY_ACC_T_LOC16;
@@ -7878,23 +9787,31 @@ class MpyAccTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyPLoc16Const16 final : public Instruction4Byte {
  public:
-  MpyPLoc16Const16() : Instruction4Byte() {}
+  constexpr MpyPLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPY_P_LOC16_CONST16;
@@ -7912,25 +9829,38 @@ class MpyPLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyPTLoc16 final : public Instruction2Byte {
  public:
-  MpyPTLoc16() : Instruction2Byte() {}
+  constexpr MpyPTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPY_P_T_LOC16;
@@ -7948,23 +9878,31 @@ class MpyPTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyaPLoc16Const16 final : public Instruction4Byte {
  public:
-  MpyaPLoc16Const16() : Instruction4Byte() {}
+  constexpr MpyaPLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYA_P_LOC16_CONST16;
@@ -7982,25 +9920,38 @@ class MpyaPLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyaPTLoc16 final : public Instruction2Byte {
  public:
-  MpyaPTLoc16() : Instruction2Byte() {}
+  constexpr MpyaPTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYA_P_T_LOC16;
@@ -8018,23 +9969,31 @@ class MpyaPTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpybAccTConst8 final : public Instruction2Byte {
  public:
-  MpybAccTConst8() : Instruction2Byte() {}
+  constexpr MpybAccTConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYB_ACC_T_CONST8;
@@ -8052,23 +10011,31 @@ class MpybAccTConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpybPTConst8 final : public Instruction2Byte {
  public:
-  MpybPTConst8() : Instruction2Byte() {}
+  constexpr MpybPTConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYB_P_T_CONST8;
@@ -8086,23 +10053,31 @@ class MpybPTConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpysPTLoc16 final : public Instruction2Byte {
  public:
-  MpysPTLoc16() : Instruction2Byte() {}
+  constexpr MpysPTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYS_P_T_LOC16;
@@ -8120,23 +10095,31 @@ class MpysPTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyuPTLoc16 final : public Instruction2Byte {
  public:
-  MpyuPTLoc16() : Instruction2Byte() {}
+  constexpr MpyuPTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYU_P_T_LOC16;
@@ -8154,23 +10137,31 @@ class MpyuPTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyuAccTLoc16 final : public Instruction2Byte {
  public:
-  MpyuAccTLoc16() : Instruction2Byte() {}
+  constexpr MpyuAccTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYU_ACC_T_LOC16;
@@ -8188,23 +10179,31 @@ class MpyuAccTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyxuAccTLoc16 final : public Instruction2Byte {
  public:
-  MpyxuAccTLoc16() : Instruction2Byte() {}
+  constexpr MpyxuAccTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYXU_ACC_T_LOC16;
@@ -8222,23 +10221,31 @@ class MpyxuAccTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class MpyxuPTLoc16 final : public Instruction2Byte {
  public:
-  MpyxuPTLoc16() : Instruction2Byte() {}
+  constexpr MpyxuPTLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MPYXU_P_T_LOC16;
@@ -8256,23 +10263,31 @@ class MpyxuPTLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Nasp final : public Instruction2Byte {
  public:
-  Nasp() : Instruction2Byte() {}
+  constexpr Nasp() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NASP;
@@ -8291,18 +10306,18 @@ class Nasp final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NegAcc final : public Instruction2Byte {
  public:
-  NegAcc() : Instruction2Byte() {}
+  constexpr NegAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NEG_ACC;
@@ -8321,18 +10336,18 @@ class NegAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NegAx final : public Instruction2Byte {
  public:
-  NegAx() : Instruction2Byte() {}
+  constexpr NegAx() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NEG_AX;
@@ -8350,23 +10365,31 @@ class NegAx final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Neg64AccP final : public Instruction2Byte {
  public:
-  Neg64AccP() : Instruction2Byte() {}
+  constexpr Neg64AccP() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NEG64_ACC_P;
@@ -8385,18 +10408,18 @@ class Neg64AccP final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NegtcAcc final : public Instruction2Byte {
  public:
-  NegtcAcc() : Instruction2Byte() {}
+  constexpr NegtcAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NEGTC_ACC;
@@ -8415,18 +10438,18 @@ class NegtcAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NopIndArpn final : public Instruction2Byte {
  public:
-  NopIndArpn() : Instruction2Byte() {}
+  constexpr NopIndArpn() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NOP_IND_ARPN;
@@ -8444,23 +10467,31 @@ class NopIndArpn final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field ind_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {ind_field};
+
   /* Helper Functions */
-  static uint8_t GetInd(uint32_t data);
-  static uint32_t SetInd(uint8_t ind);
+  static constexpr uint8_t GetInd(const uint32_t data) {
+    return ind_field.Get(data);
+  }
+  static constexpr uint32_t SetInd(const uint8_t ind) {
+    return opcode | ind_field.Set(ind);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccInd final : public Instruction2Byte {
  public:
-  NormAccInd() : Instruction2Byte() {}
+  constexpr NormAccInd() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_IND;
@@ -8479,18 +10510,18 @@ class NormAccInd final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccIndPostinc final : public Instruction2Byte {
  public:
-  NormAccIndPostinc() : Instruction2Byte() {}
+  constexpr NormAccIndPostinc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_IND_POSTINC;
@@ -8509,18 +10540,18 @@ class NormAccIndPostinc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccIndPostdec final : public Instruction2Byte {
  public:
-  NormAccIndPostdec() : Instruction2Byte() {}
+  constexpr NormAccIndPostdec() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_IND_POSTDEC;
@@ -8539,18 +10570,18 @@ class NormAccIndPostdec final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccInd0Postinc final : public Instruction2Byte {
  public:
-  NormAccInd0Postinc() : Instruction2Byte() {}
+  constexpr NormAccInd0Postinc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_IND0_POSTINC;
@@ -8569,18 +10600,18 @@ class NormAccInd0Postinc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccInd0Postdec final : public Instruction2Byte {
  public:
-  NormAccInd0Postdec() : Instruction2Byte() {}
+  constexpr NormAccInd0Postdec() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_IND0_POSTDEC;
@@ -8599,18 +10630,18 @@ class NormAccInd0Postdec final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccXarnPostinc final : public Instruction2Byte {
  public:
-  NormAccXarnPostinc() : Instruction2Byte() {}
+  constexpr NormAccXarnPostinc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_XARN_POSTINC;
@@ -8628,23 +10659,31 @@ class NormAccXarnPostinc final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_n_field = {0, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_n_field};
+
   /* Helper Functions */
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NormAccXarnPostdec final : public Instruction2Byte {
  public:
-  NormAccXarnPostdec() : Instruction2Byte() {}
+  constexpr NormAccXarnPostdec() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NORM_ACC_XARN_POSTDEC;
@@ -8662,23 +10701,31 @@ class NormAccXarnPostdec final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_n_field = {0, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_n_field};
+
   /* Helper Functions */
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NotAcc final : public Instruction2Byte {
  public:
-  NotAcc() : Instruction2Byte() {}
+  constexpr NotAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NOT_ACC;
@@ -8697,18 +10744,18 @@ class NotAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class NotAx final : public Instruction2Byte {
  public:
-  NotAx() : Instruction2Byte() {}
+  constexpr NotAx() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::NOT_AX;
@@ -8726,23 +10773,31 @@ class NotAx final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {0, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrAccLoc16 final : public Instruction2Byte {
  public:
-  OrAccLoc16() : Instruction2Byte() {}
+  constexpr OrAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_ACC_LOC16;
@@ -8760,23 +10815,31 @@ class OrAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrAccConst16Shift0_15 final : public Instruction4Byte {
  public:
-  OrAccConst16Shift0_15() : Instruction4Byte() {}
+  constexpr OrAccConst16Shift0_15() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_ACC_CONST16_SHIFT0_15;
@@ -8794,25 +10857,38 @@ class OrAccConst16Shift0_15 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {16, 4, OPERAND_SHIFT};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {shift_field, const16_field};
+
   /* Helper functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrAccConst16Shift16 final : public Instruction4Byte {
  public:
-  OrAccConst16Shift16() : Instruction4Byte() {}
+  constexpr OrAccConst16Shift16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_ACC_CONST16_SHIFT16;
@@ -8830,23 +10906,31 @@ class OrAccConst16Shift16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrAxLoc16 final : public Instruction2Byte {
  public:
-  OrAxLoc16() : Instruction2Byte() {}
+  constexpr OrAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_AX_LOC16;
@@ -8864,25 +10948,38 @@ class OrAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrIerConst16 final : public Instruction4Byte {
  public:
-  OrIerConst16() : Instruction4Byte() {}
+  constexpr OrIerConst16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_IER_CONST16;
@@ -8900,23 +10997,31 @@ class OrIerConst16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrIfrConst16 final : public Instruction4Byte {
  public:
-  OrIfrConst16() : Instruction4Byte() {}
+  constexpr OrIfrConst16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_IFR_CONST16;
@@ -8934,23 +11039,31 @@ class OrIfrConst16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrLoc16Const16 final : public Instruction4Byte {
  public:
-  OrLoc16Const16() : Instruction4Byte() {}
+  constexpr OrLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_LOC16_CONST16;
@@ -8968,25 +11081,38 @@ class OrLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrLoc16Ax final : public Instruction2Byte {
  public:
-  OrLoc16Ax() : Instruction2Byte() {}
+  constexpr OrLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OR_LOC16_AX;
@@ -9004,25 +11130,38 @@ class OrLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr std::array fields = {loc16_field, reg_ax_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OrbAxConst8 final : public Instruction2Byte {
  public:
-  OrbAxConst8() : Instruction2Byte() {}
+  constexpr OrbAxConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ORB_AX_CONST8;
@@ -9040,25 +11179,38 @@ class OrbAxConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, const8_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class OutPaLoc16 final : public Instruction4Byte {
  public:
-  OutPaLoc16() : Instruction4Byte() {}
+  constexpr OutPaLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::OUT_PA_LOC16;
@@ -9076,25 +11228,38 @@ class OutPaLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopAr1Ar0 final : public Instruction2Byte {
  public:
-  PopAr1Ar0() : Instruction2Byte() {}
+  constexpr PopAr1Ar0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_AR1_AR0;
@@ -9113,18 +11278,18 @@ class PopAr1Ar0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopAr3Ar2 final : public Instruction2Byte {
  public:
-  PopAr3Ar2() : Instruction2Byte() {}
+  constexpr PopAr3Ar2() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_AR3_AR2;
@@ -9143,18 +11308,18 @@ class PopAr3Ar2 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopAr5Ar4 final : public Instruction2Byte {
  public:
-  PopAr5Ar4() : Instruction2Byte() {}
+  constexpr PopAr5Ar4() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_AR5_AR4;
@@ -9173,18 +11338,18 @@ class PopAr5Ar4 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopAr1hAr0h final : public Instruction2Byte {
  public:
-  PopAr1hAr0h() : Instruction2Byte() {}
+  constexpr PopAr1hAr0h() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_AR1H_AR0H;
@@ -9203,18 +11368,18 @@ class PopAr1hAr0h final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopDbgier final : public Instruction2Byte {
  public:
-  PopDbgier() : Instruction2Byte() {}
+  constexpr PopDbgier() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_DBGIER;
@@ -9233,18 +11398,18 @@ class PopDbgier final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopDp final : public Instruction2Byte {
  public:
-  PopDp() : Instruction2Byte() {}
+  constexpr PopDp() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_DP;
@@ -9263,18 +11428,18 @@ class PopDp final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopDpSt1 final : public Instruction2Byte {
  public:
-  PopDpSt1() : Instruction2Byte() {}
+  constexpr PopDpSt1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_DP_ST1;
@@ -9293,18 +11458,18 @@ class PopDpSt1 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopIfr final : public Instruction2Byte {
  public:
-  PopIfr() : Instruction2Byte() {}
+  constexpr PopIfr() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_IFR;
@@ -9323,18 +11488,18 @@ class PopIfr final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopLoc16 final : public Instruction2Byte {
  public:
-  PopLoc16() : Instruction2Byte() {}
+  constexpr PopLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_LOC16;
@@ -9352,23 +11517,31 @@ class PopLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopP final : public Instruction2Byte {
  public:
-  PopP() : Instruction2Byte() {}
+  constexpr PopP() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_P;
@@ -9387,18 +11560,18 @@ class PopP final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopRpc final : public Instruction2Byte {
  public:
-  PopRpc() : Instruction2Byte() {}
+  constexpr PopRpc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_RPC;
@@ -9417,18 +11590,18 @@ class PopRpc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopSt0 final : public Instruction2Byte {
  public:
-  PopSt0() : Instruction2Byte() {}
+  constexpr PopSt0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_ST0;
@@ -9447,18 +11620,18 @@ class PopSt0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopSt1 final : public Instruction2Byte {
  public:
-  PopSt1() : Instruction2Byte() {}
+  constexpr PopSt1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_ST1;
@@ -9477,18 +11650,18 @@ class PopSt1 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopTSt0 final : public Instruction2Byte {
  public:
-  PopTSt0() : Instruction2Byte() {}
+  constexpr PopTSt0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_T_ST0;
@@ -9507,18 +11680,18 @@ class PopTSt0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PopXt final : public Instruction2Byte {
  public:
-  PopXt() : Instruction2Byte() {}
+  constexpr PopXt() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::POP_XT;
@@ -9537,18 +11710,18 @@ class PopXt final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PreadLoc16Xar7 final : public Instruction2Byte {
  public:
-  PreadLoc16Xar7() : Instruction2Byte() {}
+  constexpr PreadLoc16Xar7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PREAD_LOC16_XAR7;
@@ -9566,23 +11739,31 @@ class PreadLoc16Xar7 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushAr1Ar0 final : public Instruction2Byte {
  public:
-  PushAr1Ar0() : Instruction2Byte() {}
+  constexpr PushAr1Ar0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_AR1_AR0;
@@ -9601,18 +11782,18 @@ class PushAr1Ar0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushAr3Ar2 final : public Instruction2Byte {
  public:
-  PushAr3Ar2() : Instruction2Byte() {}
+  constexpr PushAr3Ar2() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_AR3_AR2;
@@ -9631,18 +11812,18 @@ class PushAr3Ar2 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushAr5Ar4 final : public Instruction2Byte {
  public:
-  PushAr5Ar4() : Instruction2Byte() {}
+  constexpr PushAr5Ar4() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_AR5_AR4;
@@ -9661,18 +11842,18 @@ class PushAr5Ar4 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushAr1hAr0h final : public Instruction2Byte {
  public:
-  PushAr1hAr0h() : Instruction2Byte() {}
+  constexpr PushAr1hAr0h() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_AR1H_AR0H;
@@ -9691,18 +11872,18 @@ class PushAr1hAr0h final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushDbgier final : public Instruction2Byte {
  public:
-  PushDbgier() : Instruction2Byte() {}
+  constexpr PushDbgier() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_DBGIER;
@@ -9721,18 +11902,18 @@ class PushDbgier final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushDp final : public Instruction2Byte {
  public:
-  PushDp() : Instruction2Byte() {}
+  constexpr PushDp() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_DP;
@@ -9751,18 +11932,18 @@ class PushDp final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushDpSt1 final : public Instruction2Byte {
  public:
-  PushDpSt1() : Instruction2Byte() {}
+  constexpr PushDpSt1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_DP_ST1;
@@ -9781,18 +11962,18 @@ class PushDpSt1 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushIfr final : public Instruction2Byte {
  public:
-  PushIfr() : Instruction2Byte() {}
+  constexpr PushIfr() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_IFR;
@@ -9811,18 +11992,18 @@ class PushIfr final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushLoc16 final : public Instruction2Byte {
  public:
-  PushLoc16() : Instruction2Byte() {}
+  constexpr PushLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_LOC16;
@@ -9840,23 +12021,31 @@ class PushLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushP final : public Instruction2Byte {
  public:
-  PushP() : Instruction2Byte() {}
+  constexpr PushP() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_P;
@@ -9875,18 +12064,18 @@ class PushP final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushRpc final : public Instruction2Byte {
  public:
-  PushRpc() : Instruction2Byte() {}
+  constexpr PushRpc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_RPC;
@@ -9905,18 +12094,18 @@ class PushRpc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushSt0 final : public Instruction2Byte {
  public:
-  PushSt0() : Instruction2Byte() {}
+  constexpr PushSt0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_ST0;
@@ -9935,18 +12124,18 @@ class PushSt0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushSt1 final : public Instruction2Byte {
  public:
-  PushSt1() : Instruction2Byte() {}
+  constexpr PushSt1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_ST1;
@@ -9965,18 +12154,18 @@ class PushSt1 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushTSt0 final : public Instruction2Byte {
  public:
-  PushTSt0() : Instruction2Byte() {}
+  constexpr PushTSt0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_T_ST0;
@@ -9995,18 +12184,18 @@ class PushTSt0 final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PushXt final : public Instruction2Byte {
  public:
-  PushXt() : Instruction2Byte() {}
+  constexpr PushXt() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PUSH_XT;
@@ -10025,18 +12214,18 @@ class PushXt final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class PwriteXar7Loc16 final : public Instruction2Byte {
  public:
-  PwriteXar7Loc16() : Instruction2Byte() {}
+  constexpr PwriteXar7Loc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::PWRITE_XAR7_LOC16;
@@ -10054,23 +12243,31 @@ class PwriteXar7Loc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmaclPLoc32Xar7 final : public Instruction4Byte {
  public:
-  QmaclPLoc32Xar7() : Instruction4Byte() {}
+  constexpr QmaclPLoc32Xar7() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMACL_P_LOC32_XAR7;
@@ -10088,23 +12285,31 @@ class QmaclPLoc32Xar7 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmaclPLoc32Xar7Postinc final : public Instruction4Byte {
  public:
-  QmaclPLoc32Xar7Postinc() : Instruction4Byte() {}
+  constexpr QmaclPLoc32Xar7Postinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMACL_P_LOC32_XAR7_POSTINC;
@@ -10122,23 +12327,31 @@ class QmaclPLoc32Xar7Postinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmpyalPXtLoc32 final : public Instruction4Byte {
  public:
-  QmpyalPXtLoc32() : Instruction4Byte() {}
+  constexpr QmpyalPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMPYAL_P_XT_LOC32;
@@ -10156,23 +12369,31 @@ class QmpyalPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmpylPXtLoc32 final : public Instruction4Byte {
  public:
-  QmpylPXtLoc32() : Instruction4Byte() {}
+  constexpr QmpylPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMPYL_P_XT_LOC32;
@@ -10190,23 +12411,31 @@ class QmpylPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmpylAccXtLoc32 final : public Instruction4Byte {
  public:
-  QmpylAccXtLoc32() : Instruction4Byte() {}
+  constexpr QmpylAccXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMPYL_ACC_XT_LOC32;
@@ -10224,23 +12453,31 @@ class QmpylAccXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmpyslPXtLoc32 final : public Instruction4Byte {
  public:
-  QmpyslPXtLoc32() : Instruction4Byte() {}
+  constexpr QmpyslPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMPYSL_P_XT_LOC32;
@@ -10258,23 +12495,31 @@ class QmpyslPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmpyulPXtLoc32 final : public Instruction4Byte {
  public:
-  QmpyulPXtLoc32() : Instruction4Byte() {}
+  constexpr QmpyulPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMPYUL_P_XT_LOC32;
@@ -10292,23 +12537,31 @@ class QmpyulPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class QmpyxulPXtLoc32 final : public Instruction4Byte {
  public:
-  QmpyxulPXtLoc32() : Instruction4Byte() {}
+  constexpr QmpyxulPXtLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::QMPYXUL_P_XT_LOC32;
@@ -10326,23 +12579,31 @@ class QmpyxulPXtLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class RolAcc final : public Instruction2Byte {
  public:
-  RolAcc() : Instruction2Byte() {}
+  constexpr RolAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ROL_ACC;
@@ -10361,18 +12622,18 @@ class RolAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class RorAcc final : public Instruction2Byte {
  public:
-  RorAcc() : Instruction2Byte() {}
+  constexpr RorAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ROR_ACC;
@@ -10391,18 +12652,18 @@ class RorAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class RptConst8 final : public Instruction2Byte {
  public:
-  RptConst8() : Instruction2Byte() {}
+  constexpr RptConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::RPT_CONST8;
@@ -10420,26 +12681,34 @@ class RptConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class RptLoc16 final : public Instruction2Byte {
  public:
-  RptLoc16() : Instruction2Byte() {}
+  constexpr RptLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::RPT_LOC16;
@@ -10457,26 +12726,34 @@ class RptLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SatAcc final : public Instruction2Byte {
  public:
-  SatAcc() : Instruction2Byte() {}
+  constexpr SatAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SAT_ACC;
@@ -10495,18 +12772,18 @@ class SatAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Sat64AccP final : public Instruction2Byte {
  public:
-  Sat64AccP() : Instruction2Byte() {}
+  constexpr Sat64AccP() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SAT64_ACC_P;
@@ -10525,18 +12802,18 @@ class Sat64AccP final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbOff8Cond final : public Instruction2Byte {
  public:
-  SbOff8Cond() : Instruction2Byte() {}
+  constexpr SbOff8Cond() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SB_OFF8_COND;
@@ -10545,6 +12822,8 @@ class SbOff8Cond final : public Instruction2Byte {
   static constexpr auto op_name = "sb";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -10554,29 +12833,42 @@ class SbOff8Cond final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off8_field = {0, 8, OPERAND_OFFSET, true};
+  static constexpr Field cond_field = {8, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {off8_field, cond_field};
+
   /* Helper Functions */
-  static uint8_t GetOff8(uint32_t data);
-  static uint32_t SetOff8(uint8_t off8);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint8_t GetOff8(const uint32_t data) {
+    return off8_field.Get(data);
+  }
+  static constexpr uint32_t SetOff8(const uint8_t off8) {
+    return opcode | off8_field.Set(off8);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbbuAccLoc16 final : public Instruction2Byte {
  public:
-  SbbuAccLoc16() : Instruction2Byte() {}
+  constexpr SbbuAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SBBU_ACC_LOC16;
@@ -10594,23 +12886,31 @@ class SbbuAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbfOff8Eq final : public Instruction2Byte {
  public:
-  SbfOff8Eq() : Instruction2Byte() {}
+  constexpr SbfOff8Eq() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SBF_OFF8_EQ;
@@ -10619,6 +12919,8 @@ class SbfOff8Eq final : public Instruction2Byte {
   static constexpr auto op_name = "sbf";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -10628,27 +12930,35 @@ class SbfOff8Eq final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off8_field = {0, 8, OPERAND_OFFSET, true};
+  static constexpr std::array fields = {off8_field};
+
   /* Helper Functions */
-  static uint8_t GetOff8(uint32_t data);
-  static uint32_t SetOff8(uint8_t off8);
+  static constexpr uint8_t GetOff8(const uint32_t data) {
+    return off8_field.Get(data);
+  }
+  static constexpr uint32_t SetOff8(const uint8_t off8) {
+    return opcode | off8_field.Set(off8);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbfOff8Neq final : public Instruction2Byte {
  public:
-  SbfOff8Neq() : Instruction2Byte() {}
+  constexpr SbfOff8Neq() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SBF_OFF8_NEQ;
@@ -10657,6 +12967,8 @@ class SbfOff8Neq final : public Instruction2Byte {
   static constexpr auto op_name = "sbf";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -10666,27 +12978,35 @@ class SbfOff8Neq final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off8_field = {0, 8, OPERAND_OFFSET, true};
+  static constexpr std::array fields = {off8_field};
+
   /* Helper Functions */
-  static uint8_t GetOff8(uint32_t data);
-  static uint32_t SetOff8(uint8_t off8);
+  static constexpr uint8_t GetOff8(const uint32_t data) {
+    return off8_field.Get(data);
+  }
+  static constexpr uint32_t SetOff8(const uint8_t off8) {
+    return opcode | off8_field.Set(off8);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbfOff8Tc final : public Instruction2Byte {
  public:
-  SbfOff8Tc() : Instruction2Byte() {}
+  constexpr SbfOff8Tc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SBF_OFF8_TC;
@@ -10695,6 +13015,8 @@ class SbfOff8Tc final : public Instruction2Byte {
   static constexpr auto op_name = "sbf";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -10704,27 +13026,35 @@ class SbfOff8Tc final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off8_field = {0, 8, OPERAND_OFFSET, true};
+  static constexpr std::array fields = {off8_field};
+
   /* Helper Functions */
-  static uint8_t GetOff8(uint32_t data);
-  static uint32_t SetOff8(uint8_t off8);
+  static constexpr uint8_t GetOff8(const uint32_t data) {
+    return off8_field.Get(data);
+  }
+  static constexpr uint32_t SetOff8(const uint8_t off8) {
+    return opcode | off8_field.Set(off8);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbfOff8Ntc final : public Instruction2Byte {
  public:
-  SbfOff8Ntc() : Instruction2Byte() {}
+  constexpr SbfOff8Ntc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SBF_OFF8_NTC;
@@ -10733,6 +13063,8 @@ class SbfOff8Ntc final : public Instruction2Byte {
   static constexpr auto op_name = "sbf";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
+  static constexpr bool address_independent = false;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -10742,27 +13074,35 @@ class SbfOff8Ntc final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field off8_field = {0, 8, OPERAND_OFFSET, true};
+  static constexpr std::array fields = {off8_field};
+
   /* Helper Functions */
-  static uint8_t GetOff8(uint32_t data);
-  static uint32_t SetOff8(uint8_t off8);
+  static constexpr uint8_t GetOff8(const uint32_t data) {
+    return off8_field.Get(data);
+  }
+  static constexpr uint32_t SetOff8(const uint8_t off8) {
+    return opcode | off8_field.Set(off8);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SbrkConst8 final : public Instruction2Byte {
  public:
-  SbrkConst8() : Instruction2Byte() {}
+  constexpr SbrkConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SBRK_CONST8;
@@ -10780,23 +13120,31 @@ class SbrkConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SetcMode final : public Instruction2Byte {
  public:
-  SetcMode() : Instruction2Byte() {}
+  constexpr SetcMode() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SETC_MODE;
@@ -10814,23 +13162,31 @@ class SetcMode final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field mode_field = {0, 8, OPERAND_MODE};
+  static constexpr std::array fields = {mode_field};
+
   /* Helper Functions */
-  static uint8_t GetMode(uint32_t data);
-  static uint32_t SetMode(uint8_t mode);
+  static constexpr uint8_t GetMode(const uint32_t data) {
+    return mode_field.Get(data);
+  }
+  static constexpr uint32_t SetMode(const uint8_t mode) {
+    return opcode | mode_field.Set(mode);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SetcM0M1Map final : public Instruction2Byte {
  public:
-  SetcM0M1Map() : Instruction2Byte() {}
+  constexpr SetcM0M1Map() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SETC_M0M1MAP;
@@ -10849,18 +13205,18 @@ class SetcM0M1Map final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SetcObjmode final : public Instruction2Byte {
  public:
-  SetcObjmode() : Instruction2Byte() {}
+  constexpr SetcObjmode() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SETC_OBJMODE;
@@ -10879,18 +13235,18 @@ class SetcObjmode final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SetcXf final : public Instruction2Byte {
  public:
-  SetcXf() : Instruction2Byte() {}
+  constexpr SetcXf() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SETC_XF;
@@ -10909,18 +13265,18 @@ class SetcXf final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SfrAccShift final : public Instruction2Byte {
  public:
-  SfrAccShift() : Instruction2Byte() {}
+  constexpr SfrAccShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SFR_ACC_SHIFT;
@@ -10938,23 +13294,31 @@ class SfrAccShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {0, 4, OPERAND_SHIFT};
+  static constexpr std::array fields = {shift_field};
+
   /* Helper functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SfrAccT final : public Instruction2Byte {
  public:
-  SfrAccT() : Instruction2Byte() {}
+  constexpr SfrAccT() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SFR_ACC_T;
@@ -10973,18 +13337,18 @@ class SfrAccT final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SpmShift final : public Instruction2Byte {
  public:
-  SpmShift() : Instruction2Byte() {}
+  constexpr SpmShift() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SPM_SHIFT;
@@ -11002,23 +13366,31 @@ class SpmShift final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field pm_field = {0, 3, OPERAND_MODE};
+  static constexpr std::array fields = {pm_field};
+
   /* Helper functions */
-  static uint8_t GetPM(uint32_t data);
-  static uint32_t SetPM(uint8_t pm);
+  static constexpr uint8_t GetPM(const uint32_t data) {
+    return pm_field.Get(data);
+  }
+  static constexpr uint32_t SetPM(const uint8_t pm) {
+    return opcode | pm_field.Set(pm);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SqraLoc16 final : public Instruction4Byte {
  public:
-  SqraLoc16() : Instruction4Byte() {}
+  constexpr SqraLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SQRA_LOC16;
@@ -11036,23 +13408,31 @@ class SqraLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SqrsLoc16 final : public Instruction4Byte {
  public:
-  SqrsLoc16() : Instruction4Byte() {}
+  constexpr SqrsLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SQRS_LOC16;
@@ -11070,23 +13450,31 @@ class SqrsLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccLoc16Objmode1 final : public Instruction2Byte {
  public:
-  SubAccLoc16Objmode1() : Instruction2Byte() {}
+  constexpr SubAccLoc16Objmode1() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_LOC16_OBJMODE1;
@@ -11104,23 +13492,31 @@ class SubAccLoc16Objmode1 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccLoc16Objmode0 final : public Instruction2Byte {
  public:
-  SubAccLoc16Objmode0() : Instruction2Byte() {}
+  constexpr SubAccLoc16Objmode0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_LOC16_OBJMODE0;
@@ -11138,23 +13534,31 @@ class SubAccLoc16Objmode0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccLoc16Shift1_15Objmode1 final : public Instruction4Byte {
  public:
-  SubAccLoc16Shift1_15Objmode1() : Instruction4Byte() {}
+  constexpr SubAccLoc16Shift1_15Objmode1() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_LOC16_SHIFT1_15_OBJMODE1;
@@ -11172,25 +13576,38 @@ class SubAccLoc16Shift1_15Objmode1 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {8, 4, OPERAND_SHIFT};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {shift_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccLoc16Shift1_15Objmode0 final : public Instruction2Byte {
  public:
-  SubAccLoc16Shift1_15Objmode0() : Instruction2Byte() {}
+  constexpr SubAccLoc16Shift1_15Objmode0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_LOC16_SHIFT1_15_OBJMODE0;
@@ -11208,25 +13625,38 @@ class SubAccLoc16Shift1_15Objmode0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {8, 4, OPERAND_SHIFT};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {shift_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccLoc16Shift16 final : public Instruction2Byte {
  public:
-  SubAccLoc16Shift16() : Instruction2Byte() {}
+  constexpr SubAccLoc16Shift16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_LOC16_SHIFT16;
@@ -11244,23 +13674,31 @@ class SubAccLoc16Shift16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccLoc16ShiftT final : public Instruction4Byte {
  public:
-  SubAccLoc16ShiftT() : Instruction4Byte() {}
+  constexpr SubAccLoc16ShiftT() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_LOC16_SHIFT_T;
@@ -11278,23 +13716,31 @@ class SubAccLoc16ShiftT final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAccConst16Shift final : public Instruction4Byte {
  public:
-  SubAccConst16Shift() : Instruction4Byte() {}
+  constexpr SubAccConst16Shift() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_ACC_CONST16_SHIFT;
@@ -11312,25 +13758,38 @@ class SubAccConst16Shift final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {16, 4, OPERAND_SHIFT};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {shift_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubAxLoc16 final : public Instruction2Byte {
  public:
-  SubAxLoc16() : Instruction2Byte() {}
+  constexpr SubAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_AX_LOC16;
@@ -11348,25 +13807,38 @@ class SubAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubLoc16Ax final : public Instruction2Byte {
  public:
-  SubLoc16Ax() : Instruction2Byte() {}
+  constexpr SubLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUB_LOC16_AX;
@@ -11384,25 +13856,38 @@ class SubLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubbAccConst8 final : public Instruction2Byte {
  public:
-  SubbAccConst8() : Instruction2Byte() {}
+  constexpr SubbAccConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBB_ACC_CONST8;
@@ -11420,23 +13905,31 @@ class SubbAccConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const8_field};
+
   /* Helper Functions */
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubbSpConst7 final : public Instruction2Byte {
  public:
-  SubbSpConst7() : Instruction2Byte() {}
+  constexpr SubbSpConst7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBB_SP_CONST7;
@@ -11454,23 +13947,31 @@ class SubbSpConst7 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const7_field = {0, 7, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const7_field};
+
   /* Helper Functions */
-  static uint8_t GetConst7(uint32_t data);
-  static uint32_t SetConst7(uint8_t const7);
+  static constexpr uint8_t GetConst7(const uint32_t data) {
+    return const7_field.Get(data);
+  }
+  static constexpr uint32_t SetConst7(const uint8_t const7) {
+    return opcode | const7_field.Set(const7);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubbXarnConst7 final : public Instruction2Byte {
  public:
-  SubbXarnConst7() : Instruction2Byte() {}
+  constexpr SubbXarnConst7() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBB_XARN_CONST7;
@@ -11488,25 +13989,38 @@ class SubbXarnConst7 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_n_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field const7_field = {0, 7, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_n_field, const7_field};
+
   /* Helper Functions */
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
-  static uint8_t GetConst7(uint32_t data);
-  static uint32_t SetConst7(uint8_t const7);
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
+  static constexpr uint8_t GetConst7(const uint32_t data) {
+    return const7_field.Get(data);
+  }
+  static constexpr uint32_t SetConst7(const uint8_t const7) {
+    return opcode | const7_field.Set(const7);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubblAccLoc32 final : public Instruction4Byte {
  public:
-  SubblAccLoc32() : Instruction4Byte() {}
+  constexpr SubblAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBBL_ACC_LOC32;
@@ -11524,23 +14038,31 @@ class SubblAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubcuAccLoc16 final : public Instruction2Byte {
  public:
-  SubcuAccLoc16() : Instruction2Byte() {}
+  constexpr SubcuAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBCU_ACC_LOC16;
@@ -11558,23 +14080,31 @@ class SubcuAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubculAccLoc32 final : public Instruction4Byte {
  public:
-  SubculAccLoc32() : Instruction4Byte() {}
+  constexpr SubculAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBCUL_ACC_LOC32;
@@ -11592,23 +14122,31 @@ class SubculAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SublAccLoc32 final : public Instruction2Byte {
  public:
-  SublAccLoc32() : Instruction2Byte() {}
+  constexpr SublAccLoc32() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBL_ACC_LOC32;
@@ -11626,23 +14164,31 @@ class SublAccLoc32 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SublLoc32Acc final : public Instruction4Byte {
  public:
-  SublLoc32Acc() : Instruction4Byte() {}
+  constexpr SublLoc32Acc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBL_LOC32_ACC;
@@ -11660,23 +14206,31 @@ class SublLoc32Acc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubrLoc16Ax final : public Instruction2Byte {
  public:
-  SubrLoc16Ax() : Instruction2Byte() {}
+  constexpr SubrLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBR_LOC16_AX;
@@ -11694,25 +14248,38 @@ class SubrLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubrlLoc32Acc final : public Instruction4Byte {
  public:
-  SubrlLoc32Acc() : Instruction4Byte() {}
+  constexpr SubrlLoc32Acc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBRL_LOC32_ACC;
@@ -11730,23 +14297,31 @@ class SubrlLoc32Acc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubuAccLoc16 final : public Instruction2Byte {
  public:
-  SubuAccLoc16() : Instruction2Byte() {}
+  constexpr SubuAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBU_ACC_LOC16;
@@ -11764,23 +14339,31 @@ class SubuAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubulAccLoc32 final : public Instruction4Byte {
  public:
-  SubulAccLoc32() : Instruction4Byte() {}
+  constexpr SubulAccLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBUL_ACC_LOC32;
@@ -11798,23 +14381,31 @@ class SubulAccLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class SubulPLoc32 final : public Instruction4Byte {
  public:
-  SubulPLoc32() : Instruction4Byte() {}
+  constexpr SubulPLoc32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::SUBUL_P_LOC32;
@@ -11832,23 +14423,31 @@ class SubulPLoc32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {loc32_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc32(uint32_t data);
-  static uint32_t SetLoc32(uint8_t loc32);
+  static constexpr uint8_t GetLoc32(const uint32_t data) {
+    return loc32_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc32(const uint8_t loc32) {
+    return opcode | loc32_field.Set(loc32);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class TbitLoc16Bit final : public Instruction2Byte {
  public:
-  TbitLoc16Bit() : Instruction2Byte() {}
+  constexpr TbitLoc16Bit() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::TBIT_LOC16_BIT;
@@ -11866,25 +14465,38 @@ class TbitLoc16Bit final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field bit_index_field = {8, 4, OPERAND_CONSTANT};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {bit_index_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetBitIndex(uint32_t data);
-  static uint32_t SetBitIndex(uint8_t bit);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetBitIndex(const uint32_t data) {
+    return bit_index_field.Get(data);
+  }
+  static constexpr uint32_t SetBitIndex(const uint8_t bit) {
+    return opcode | bit_index_field.Set(bit);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class TbitLoc16T final : public Instruction4Byte {
  public:
-  TbitLoc16T() : Instruction4Byte() {}
+  constexpr TbitLoc16T() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::TBIT_LOC16_T;
@@ -11902,23 +14514,31 @@ class TbitLoc16T final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class TclrLoc16Bit final : public Instruction4Byte {
  public:
-  TclrLoc16Bit() : Instruction4Byte() {}
+  constexpr TclrLoc16Bit() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::TCLR_LOC16_BIT;
@@ -11936,25 +14556,38 @@ class TclrLoc16Bit final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field bit_index_field = {8, 4, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, bit_index_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetBitIndex(uint32_t data);
-  static uint32_t SetBitIndex(uint8_t bit);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetBitIndex(const uint32_t data) {
+    return bit_index_field.Get(data);
+  }
+  static constexpr uint32_t SetBitIndex(const uint8_t bit) {
+    return opcode | bit_index_field.Set(bit);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class TestAcc final : public Instruction2Byte {
  public:
-  TestAcc() : Instruction2Byte() {}
+  constexpr TestAcc() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::TEST_ACC;
@@ -11973,18 +14606,18 @@ class TestAcc final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class TrapVec final : public Instruction2Byte {
  public:
-  TrapVec() : Instruction2Byte() {}
+  constexpr TrapVec() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::TRAP_VEC;
@@ -11993,6 +14626,7 @@ class TrapVec final : public Instruction2Byte {
   static constexpr auto op_name = "trap";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_ANY;
+  static constexpr BranchKind branch = BRANCH_EXCEPTION;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12002,26 +14636,34 @@ class TrapVec final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field vec_field = {0, 5, OPERAND_CONSTANT};
+  static constexpr std::array fields = {vec_field};
+
   /* Helper Functions */
-  static uint8_t GetVec(uint32_t data);
-  static uint32_t SetVec(uint8_t vec);
+  static constexpr uint8_t GetVec(const uint32_t data) {
+    return vec_field.Get(data);
+  }
+  static constexpr uint32_t SetVec(const uint8_t vec) {
+    return opcode | vec_field.Set(vec);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class TsetLoc16Bit final : public Instruction4Byte {
  public:
-  TsetLoc16Bit() : Instruction4Byte() {}
+  constexpr TsetLoc16Bit() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::TSET_LOC16_BIT;
@@ -12039,25 +14681,38 @@ class TsetLoc16Bit final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr Field bit_index_field = {8, 4, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, bit_index_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint8_t GetBitIndex(uint32_t data);
-  static uint32_t SetBitIndex(uint8_t bit);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint8_t GetBitIndex(const uint32_t data) {
+    return bit_index_field.Get(data);
+  }
+  static constexpr uint32_t SetBitIndex(const uint8_t bit) {
+    return opcode | bit_index_field.Set(bit);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class UoutPaLoc16 final : public Instruction4Byte {
  public:
-  UoutPaLoc16() : Instruction4Byte() {}
+  constexpr UoutPaLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::UOUT_PA_LOC16;
@@ -12075,25 +14730,38 @@ class UoutPaLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbAl final : public Instruction2Byte {
  public:
-  XbAl() : Instruction2Byte() {}
+  constexpr XbAl() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XB_AL;
@@ -12102,6 +14770,7 @@ class XbAl final : public Instruction2Byte {
   static constexpr auto op_name = "xb";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_INDIRECT;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12112,21 +14781,21 @@ class XbAl final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbPmaArpn final : public Instruction4Byte {
  public:
-  XbPmaArpn() : Instruction4Byte() {}
+  constexpr XbPmaArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XB_PMA_APRN;
@@ -12135,6 +14804,7 @@ class XbPmaArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xb";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_UNCONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12144,29 +14814,42 @@ class XbPmaArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbPmaCond final : public Instruction4Byte {
  public:
-  XbPmaCond() : Instruction4Byte() {}
+  constexpr XbPmaCond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XB_PMA_COND;
@@ -12175,6 +14858,7 @@ class XbPmaCond final : public Instruction4Byte {
   static constexpr auto op_name = "xb";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12184,29 +14868,42 @@ class XbPmaCond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field cond_field = {16, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {const16_field, cond_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaInd final : public Instruction4Byte {
  public:
-  XbanzPmaInd() : Instruction4Byte() {}
+  constexpr XbanzPmaInd() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND;
@@ -12215,6 +14912,7 @@ class XbanzPmaInd final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12224,27 +14922,35 @@ class XbanzPmaInd final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaIndPostinc final : public Instruction4Byte {
  public:
-  XbanzPmaIndPostinc() : Instruction4Byte() {}
+  constexpr XbanzPmaIndPostinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND_POSTINC;
@@ -12253,6 +14959,7 @@ class XbanzPmaIndPostinc final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12262,27 +14969,35 @@ class XbanzPmaIndPostinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaIndPostdec final : public Instruction4Byte {
  public:
-  XbanzPmaIndPostdec() : Instruction4Byte() {}
+  constexpr XbanzPmaIndPostdec() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND_POSTDEC;
@@ -12291,6 +15006,7 @@ class XbanzPmaIndPostdec final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12300,27 +15016,35 @@ class XbanzPmaIndPostdec final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaInd0Postinc final : public Instruction4Byte {
  public:
-  XbanzPmaInd0Postinc() : Instruction4Byte() {}
+  constexpr XbanzPmaInd0Postinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND0_POSTINC;
@@ -12329,6 +15053,7 @@ class XbanzPmaInd0Postinc final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12338,27 +15063,35 @@ class XbanzPmaInd0Postinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaInd0Postdec final : public Instruction4Byte {
  public:
-  XbanzPmaInd0Postdec() : Instruction4Byte() {}
+  constexpr XbanzPmaInd0Postdec() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND0_POSTDEC;
@@ -12367,6 +15100,7 @@ class XbanzPmaInd0Postdec final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12376,27 +15110,35 @@ class XbanzPmaInd0Postdec final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaIndArpn final : public Instruction4Byte {
  public:
-  XbanzPmaIndArpn() : Instruction4Byte() {}
+  constexpr XbanzPmaIndArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND_ARPN;
@@ -12405,6 +15147,7 @@ class XbanzPmaIndArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12414,29 +15157,42 @@ class XbanzPmaIndArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaIndPostincArpn final : public Instruction4Byte {
  public:
-  XbanzPmaIndPostincArpn() : Instruction4Byte() {}
+  constexpr XbanzPmaIndPostincArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND_POSTINC_ARPN;
@@ -12445,6 +15201,7 @@ class XbanzPmaIndPostincArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12454,29 +15211,42 @@ class XbanzPmaIndPostincArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaIndPostdecArpn final : public Instruction4Byte {
  public:
-  XbanzPmaIndPostdecArpn() : Instruction4Byte() {}
+  constexpr XbanzPmaIndPostdecArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND_POSTDEC_ARPN;
@@ -12485,6 +15255,7 @@ class XbanzPmaIndPostdecArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12494,29 +15265,42 @@ class XbanzPmaIndPostdecArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaInd0PostincArpn final : public Instruction4Byte {
  public:
-  XbanzPmaInd0PostincArpn() : Instruction4Byte() {}
+  constexpr XbanzPmaInd0PostincArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND0_POSTINC_ARPN;
@@ -12525,6 +15309,7 @@ class XbanzPmaInd0PostincArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12534,29 +15319,42 @@ class XbanzPmaInd0PostincArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XbanzPmaInd0PostdecArpn final : public Instruction4Byte {
  public:
-  XbanzPmaInd0PostdecArpn() : Instruction4Byte() {}
+  constexpr XbanzPmaInd0PostdecArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XBANZ_PMA_IND0_POSTDEC_ARPN;
@@ -12565,6 +15363,7 @@ class XbanzPmaInd0PostdecArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xbanz";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12574,29 +15373,42 @@ class XbanzPmaInd0PostdecArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XcallAl final : public Instruction2Byte {
  public:
-  XcallAl() : Instruction2Byte() {}
+  constexpr XcallAl() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XCALL_AL;
@@ -12605,6 +15417,7 @@ class XcallAl final : public Instruction2Byte {
   static constexpr auto op_name = "xcall";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_INDIRECT;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12615,21 +15428,21 @@ class XcallAl final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XcallPmaArpn final : public Instruction4Byte {
  public:
-  XcallPmaArpn() : Instruction4Byte() {}
+  constexpr XcallPmaArpn() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XCALL_PMA_ARPN;
@@ -12638,6 +15451,7 @@ class XcallPmaArpn final : public Instruction4Byte {
   static constexpr auto op_name = "xcall";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_UNCONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12647,29 +15461,42 @@ class XcallPmaArpn final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field reg_n_field = {16, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {const16_field, reg_n_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetRegN(uint32_t data);
-  static uint32_t SetRegN(uint8_t n);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetRegN(const uint32_t data) {
+    return reg_n_field.Get(data);
+  }
+  static constexpr uint32_t SetRegN(const uint8_t n) {
+    return opcode | reg_n_field.Set(n);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XcallPmaCond final : public Instruction4Byte {
  public:
-  XcallPmaCond() : Instruction4Byte() {}
+  constexpr XcallPmaCond() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XCALL_PMA_COND;
@@ -12678,6 +15505,7 @@ class XcallPmaCond final : public Instruction4Byte {
   static constexpr auto op_name = "xcall";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -12687,29 +15515,42 @@ class XcallPmaCond final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr Field cond_field = {16, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {const16_field, cond_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
   static uint64_t GetTarget(uint32_t data, uint64_t addr);
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XmacPLoc16Pma final : public Instruction4Byte {
  public:
-  XmacPLoc16Pma() : Instruction4Byte() {}
+  constexpr XmacPLoc16Pma() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XMAC_P_LOC16_PMA;
@@ -12727,25 +15568,38 @@ class XmacPLoc16Pma final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XmacdPLoc16Pma final : public Instruction4Byte {
  public:
-  XmacdPLoc16Pma() : Instruction4Byte() {}
+  constexpr XmacdPLoc16Pma() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XMACD_P_LOC16_PMA;
@@ -12763,25 +15617,38 @@ class XmacdPLoc16Pma final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorAccLoc16 final : public Instruction2Byte {
  public:
-  XorAccLoc16() : Instruction2Byte() {}
+  constexpr XorAccLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XOR_ACC_LOC16;
@@ -12799,23 +15666,31 @@ class XorAccLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorAccConst16Shift0_15 final : public Instruction4Byte {
  public:
-  XorAccConst16Shift0_15() : Instruction4Byte() {}
+  constexpr XorAccConst16Shift0_15() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XOR_ACC_CONST16_SHIFT0_15;
@@ -12833,25 +15708,38 @@ class XorAccConst16Shift0_15 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field shift_field = {16, 4, OPERAND_SHIFT};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {shift_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetShift(uint32_t data);
-  static uint32_t SetShift(uint8_t shift);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetShift(const uint32_t data) {
+    return shift_field.Get(data);
+  }
+  static constexpr uint32_t SetShift(const uint8_t shift) {
+    return opcode | shift_field.Set(shift);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorAccConst16Shift16 final : public Instruction4Byte {
  public:
-  XorAccConst16Shift16() : Instruction4Byte() {}
+  constexpr XorAccConst16Shift16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XOR_ACC_CONST16_SHIFT16;
@@ -12869,23 +15757,31 @@ class XorAccConst16Shift16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {const16_field};
+
   /* Helper Functions */
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorAxLoc16 final : public Instruction2Byte {
  public:
-  XorAxLoc16() : Instruction2Byte() {}
+  constexpr XorAxLoc16() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XOR_AX_LOC16;
@@ -12903,25 +15799,38 @@ class XorAxLoc16 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorLoc16Ax final : public Instruction2Byte {
  public:
-  XorLoc16Ax() : Instruction2Byte() {}
+  constexpr XorLoc16Ax() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XOR_LOC16_AX;
@@ -12939,25 +15848,38 @@ class XorLoc16Ax final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_ax_field, loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorLoc16Const16 final : public Instruction4Byte {
  public:
-  XorLoc16Const16() : Instruction4Byte() {}
+  constexpr XorLoc16Const16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XOR_LOC16_CONST16;
@@ -12975,25 +15897,38 @@ class XorLoc16Const16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XorbAxConst8 final : public Instruction2Byte {
  public:
-  XorbAxConst8() : Instruction2Byte() {}
+  constexpr XorbAxConst8() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XORB_AX_CONST8;
@@ -13011,25 +15946,38 @@ class XorbAxConst8 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_ax_field = {8, 1, OPERAND_REGISTER};
+  static constexpr Field const8_field = {0, 8, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_ax_field, const8_field};
+
   /* Helper Functions */
-  static uint8_t GetRegAx(uint32_t data);
-  static uint32_t SetRegAx(uint8_t x);
-  static uint8_t GetConst8(uint32_t data);
-  static uint32_t SetConst8(uint8_t const8);
+  static constexpr uint8_t GetRegAx(const uint32_t data) {
+    return reg_ax_field.Get(data);
+  }
+  static constexpr uint32_t SetRegAx(const uint8_t x) {
+    return opcode | reg_ax_field.Set(x);
+  }
+  static constexpr uint8_t GetConst8(const uint32_t data) {
+    return const8_field.Get(data);
+  }
+  static constexpr uint32_t SetConst8(const uint8_t const8) {
+    return opcode | const8_field.Set(const8);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XpreadLoc16Pma final : public Instruction4Byte {
  public:
-  XpreadLoc16Pma() : Instruction4Byte() {}
+  constexpr XpreadLoc16Pma() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XPREAD_LOC16_PMA;
@@ -13047,25 +15995,38 @@ class XpreadLoc16Pma final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {16, 8, OPERAND_LOC16};
+  static constexpr Field const16_field = {0, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {loc16_field, const16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
-  static uint16_t GetConst16(uint32_t data);
-  static uint32_t SetConst16(uint16_t const16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
+  static constexpr uint16_t GetConst16(const uint32_t data) {
+    return const16_field.Get(data);
+  }
+  static constexpr uint32_t SetConst16(const uint16_t const16) {
+    return opcode | const16_field.Set(const16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XpreadLoc16Al final : public Instruction4Byte {
  public:
-  XpreadLoc16Al() : Instruction4Byte() {}
+  constexpr XpreadLoc16Al() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XPREAD_LOC16_AL;
@@ -13083,23 +16044,31 @@ class XpreadLoc16Al final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XpwriteAlLoc16 final : public Instruction4Byte {
  public:
-  XpwriteAlLoc16() : Instruction4Byte() {}
+  constexpr XpwriteAlLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XPWRITE_AL_LOC16;
@@ -13117,23 +16086,31 @@ class XpwriteAlLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class XretcCond final : public Instruction2Byte {
  public:
-  XretcCond() : Instruction2Byte() {}
+  constexpr XretcCond() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::XRETC_COND;
@@ -13142,6 +16119,7 @@ class XretcCond final : public Instruction2Byte {
   static constexpr auto op_name = "xretc";
   static constexpr bool repeatable = false;
   static constexpr ObjectMode objmode = OBJMODE_1;
+  static constexpr BranchKind branch = BRANCH_CONDITIONAL_RETURN;
 
   /* Overrides for abstract instruction getters */
   uint32_t GetOpcode() override { return opcode; }
@@ -13151,26 +16129,34 @@ class XretcCond final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field cond_field = {0, 4, OPERAND_CONDITION};
+  static constexpr std::array fields = {cond_field};
+
   /* Helper Functions */
-  static uint8_t GetCond(uint32_t data);
-  static uint32_t SetCond(uint8_t cond);
+  static constexpr uint8_t GetCond(const uint32_t data) {
+    return cond_field.Get(data);
+  }
+  static constexpr uint32_t SetCond(const uint8_t cond) {
+    return opcode | cond_field.Set(cond);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Info(const uint8_t* data, uint64_t addr, BN::InstructionInfo& result,
-            TIC28XArchitecture* arch) override;
+  bool Info(const DecodedInstruction& decoded, uint64_t addr,
+            BN::InstructionInfo& result, TIC28XArchitecture* arch) override;
 
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class ZalrAccLoc16 final : public Instruction4Byte {
  public:
-  ZalrAccLoc16() : Instruction4Byte() {}
+  constexpr ZalrAccLoc16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ZALR_ACC_LOC16;
@@ -13188,23 +16174,31 @@ class ZalrAccLoc16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field loc16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {loc16_field};
+
   /* Helper Functions */
-  static uint8_t GetLoc16(uint32_t data);
-  static uint32_t SetLoc16(uint8_t loc16);
+  static constexpr uint8_t GetLoc16(const uint32_t data) {
+    return loc16_field.Get(data);
+  }
+  static constexpr uint32_t SetLoc16(const uint8_t loc16) {
+    return opcode | loc16_field.Set(loc16);
+  }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Zapa final : public Instruction2Byte {
  public:
-  Zapa() : Instruction2Byte() {}
+  constexpr Zapa() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ZAPA;
@@ -13223,11 +16217,11 @@ class Zapa final : public Instruction2Byte {
   ObjectMode GetObjmode() override { return objmode; }
 
   /* Binary Ninja Function Implementations */
-  bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
             std::vector<BN::InstructionTextToken>& result,
             AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
@@ -13252,7 +16246,7 @@ class Zapa final : public Instruction2Byte {
 
 class Absf32RahRbh final : public Instruction4Byte {
  public:
-  Absf32RahRbh() : Instruction4Byte() {}
+  constexpr Absf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ABSF32_RAH_RBH;
@@ -13270,25 +16264,38 @@ class Absf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Addf32Rah16fhiRbh final : public Instruction4Byte {
  public:
-  Addf32Rah16fhiRbh() : Instruction4Byte() {}
+  constexpr Addf32Rah16fhiRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDF32_RAH_16FHI_RBH;
@@ -13306,27 +16313,45 @@ class Addf32Rah16fhiRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr Field fhi16_field = {6, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_a_field, reg_b_field, fhi16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
-  static uint16_t Get16fhi(uint32_t data);
-  static uint32_t Set16fhi(uint16_t i);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
+  static constexpr uint16_t Get16fhi(const uint32_t data) {
+    return fhi16_field.Get(data);
+  }
+  static constexpr uint32_t Set16fhi(const uint16_t i) {
+    return opcode | fhi16_field.Set(i);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Addf32RahRbhRch final : public Instruction4Byte {
  public:
-  Addf32RahRbhRch() : Instruction4Byte() {}
+  constexpr Addf32RahRbhRch() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::ADDF32_RAH_RBH_RCH;
@@ -13344,27 +16369,45 @@ class Addf32RahRbhRch final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr Field reg_c_field = {6, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field, reg_c_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
-  static uint8_t GetRegC(uint32_t data);
-  static uint32_t SetRegC(uint8_t c);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
+  static constexpr uint8_t GetRegC(const uint32_t data) {
+    return reg_c_field.Get(data);
+  }
+  static constexpr uint32_t SetRegC(const uint8_t c) {
+    return opcode | reg_c_field.Set(c);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Addf32RdhRehRfhMov32Mem32Rah final : public Instruction4Byte {
  public:
-  Addf32RdhRehRfhMov32Mem32Rah() : Instruction4Byte() {}
+  constexpr Addf32RdhRehRfhMov32Mem32Rah() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode =
@@ -13383,31 +16426,60 @@ class Addf32RdhRehRfhMov32Mem32Rah final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field reg_d_field = {11, 3, OPERAND_REGISTER};
+  static constexpr Field reg_e_field = {14, 3, OPERAND_REGISTER};
+  static constexpr Field reg_f_field = {17, 3, OPERAND_REGISTER};
+  static constexpr Field mem32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {reg_a_field, reg_d_field, reg_e_field,
+                                        reg_f_field, mem32_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
-  static uint8_t GetRegE(uint32_t data);
-  static uint32_t SetRegE(uint8_t e);
-  static uint8_t GetRegF(uint32_t data);
-  static uint32_t SetRegF(uint8_t f);
-  static uint16_t GetMem32(uint32_t data);
-  static uint32_t SetMem32(uint16_t mem32);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
+  static constexpr uint8_t GetRegE(const uint32_t data) {
+    return reg_e_field.Get(data);
+  }
+  static constexpr uint32_t SetRegE(const uint8_t e) {
+    return opcode | reg_e_field.Set(e);
+  }
+  static constexpr uint8_t GetRegF(const uint32_t data) {
+    return reg_f_field.Get(data);
+  }
+  static constexpr uint32_t SetRegF(const uint8_t f) {
+    return opcode | reg_f_field.Set(f);
+  }
+  static constexpr uint16_t GetMem32(const uint32_t data) {
+    return mem32_field.Get(data);
+  }
+  static constexpr uint32_t SetMem32(const uint16_t mem32) {
+    return opcode | mem32_field.Set(mem32);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Addf32RdhRehRfhMov32RahMem32 final : public Instruction4Byte {
  public:
-  Addf32RdhRehRfhMov32RahMem32() : Instruction4Byte() {}
+  constexpr Addf32RdhRehRfhMov32RahMem32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode =
@@ -13426,31 +16498,60 @@ class Addf32RdhRehRfhMov32RahMem32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field reg_d_field = {11, 3, OPERAND_REGISTER};
+  static constexpr Field reg_e_field = {14, 3, OPERAND_REGISTER};
+  static constexpr Field reg_f_field = {17, 3, OPERAND_REGISTER};
+  static constexpr Field mem32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {reg_a_field, reg_d_field, reg_e_field,
+                                        reg_f_field, mem32_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
-  static uint8_t GetRegE(uint32_t data);
-  static uint32_t SetRegE(uint8_t e);
-  static uint8_t GetRegF(uint32_t data);
-  static uint32_t SetRegF(uint8_t f);
-  static uint16_t GetMem32(uint32_t data);
-  static uint32_t SetMem32(uint16_t mem32);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
+  static constexpr uint8_t GetRegE(const uint32_t data) {
+    return reg_e_field.Get(data);
+  }
+  static constexpr uint32_t SetRegE(const uint8_t e) {
+    return opcode | reg_e_field.Set(e);
+  }
+  static constexpr uint8_t GetRegF(const uint32_t data) {
+    return reg_f_field.Get(data);
+  }
+  static constexpr uint32_t SetRegF(const uint8_t f) {
+    return opcode | reg_f_field.Set(f);
+  }
+  static constexpr uint16_t GetMem32(const uint32_t data) {
+    return mem32_field.Get(data);
+  }
+  static constexpr uint32_t SetMem32(const uint16_t mem32) {
+    return opcode | mem32_field.Set(mem32);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpf32RahRbh final : public Instruction4Byte {
  public:
-  Cmpf32RahRbh() : Instruction4Byte() {}
+  constexpr Cmpf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPF32_RAH_RBH;
@@ -13468,25 +16569,38 @@ class Cmpf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpf32Rah16fhi final : public Instruction4Byte {
  public:
-  Cmpf32Rah16fhi() : Instruction4Byte() {}
+  constexpr Cmpf32Rah16fhi() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPF32_RAH_16FHI;
@@ -13504,25 +16618,38 @@ class Cmpf32Rah16fhi final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field fhi16_field = {3, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_a_field, fhi16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint16_t Get16fhi(uint32_t data);
-  static uint32_t Set16fhi(uint16_t i);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint16_t Get16fhi(const uint32_t data) {
+    return fhi16_field.Get(data);
+  }
+  static constexpr uint32_t Set16fhi(const uint16_t i) {
+    return opcode | fhi16_field.Set(i);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Cmpf32Rah0 final : public Instruction2Byte {
  public:
-  Cmpf32Rah0() : Instruction2Byte() {}
+  constexpr Cmpf32Rah0() : Instruction2Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::CMPF32_RAH_0;
@@ -13540,23 +16667,31 @@ class Cmpf32Rah0 final : public Instruction2Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Einvf32RahRbh final : public Instruction4Byte {
  public:
-  Einvf32RahRbh() : Instruction4Byte() {}
+  constexpr Einvf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::EINVF32_RAH_RBH;
@@ -13574,25 +16709,38 @@ class Einvf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Eisqrtf32RahRbh final : public Instruction4Byte {
  public:
-  Eisqrtf32RahRbh() : Instruction4Byte() {}
+  constexpr Eisqrtf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::EISQRTF32_RAH_RBH;
@@ -13610,25 +16758,38 @@ class Eisqrtf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class F32toi16RahRbh final : public Instruction4Byte {
  public:
-  F32toi16RahRbh() : Instruction4Byte() {}
+  constexpr F32toi16RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::F32TOI16_RAH_RBH;
@@ -13646,25 +16807,38 @@ class F32toi16RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class F32toi16rRahRbh final : public Instruction4Byte {
  public:
-  F32toi16rRahRbh() : Instruction4Byte() {}
+  constexpr F32toi16rRahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::F32TOI16R_RAH_RBH;
@@ -13682,25 +16856,38 @@ class F32toi16rRahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class F32toi32RahRbh final : public Instruction4Byte {
  public:
-  F32toi32RahRbh() : Instruction4Byte() {}
+  constexpr F32toi32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::F32TOI32_RAH_RBH;
@@ -13718,25 +16905,38 @@ class F32toi32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class F32toui16RahRbh final : public Instruction4Byte {
  public:
-  F32toui16RahRbh() : Instruction4Byte() {}
+  constexpr F32toui16RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::F32TOUI16_RAH_RBH;
@@ -13754,25 +16954,38 @@ class F32toui16RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class F32toui16rRahRbh final : public Instruction4Byte {
  public:
-  F32toui16rRahRbh() : Instruction4Byte() {}
+  constexpr F32toui16rRahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::F32TOUI16R_RAH_RBH;
@@ -13790,25 +17003,38 @@ class F32toui16rRahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class F32toui32RahRbh final : public Instruction4Byte {
  public:
-  F32toui32RahRbh() : Instruction4Byte() {}
+  constexpr F32toui32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::F32TOUI32_RAH_RBH;
@@ -13826,25 +17052,38 @@ class F32toui32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Fracf32RahRbh final : public Instruction4Byte {
  public:
-  Fracf32RahRbh() : Instruction4Byte() {}
+  constexpr Fracf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::FRACF32_RAH_RBH;
@@ -13862,25 +17101,38 @@ class Fracf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class I16tof32RahRbh final : public Instruction4Byte {
  public:
-  I16tof32RahRbh() : Instruction4Byte() {}
+  constexpr I16tof32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::I16TOF32_RAH_RBH;
@@ -13898,25 +17150,38 @@ class I16tof32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class I16tof32RahMem16 final : public Instruction4Byte {
  public:
-  I16tof32RahMem16() : Instruction4Byte() {}
+  constexpr I16tof32RahMem16() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::I16TOF32_RAH_MEM16;
@@ -13934,25 +17199,38 @@ class I16tof32RahMem16 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field mem16_field = {0, 8, OPERAND_LOC16};
+  static constexpr std::array fields = {reg_a_field, mem16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint16_t GetMem16(uint32_t data);
-  static uint32_t SetMem16(uint16_t mem16);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint16_t GetMem16(const uint32_t data) {
+    return mem16_field.Get(data);
+  }
+  static constexpr uint32_t SetMem16(const uint16_t mem16) {
+    return opcode | mem16_field.Set(mem16);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class I32tof32RahMem32 final : public Instruction4Byte {
  public:
-  I32tof32RahMem32() : Instruction4Byte() {}
+  constexpr I32tof32RahMem32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::I32TOF32_RAH_MEM32;
@@ -13970,25 +17248,38 @@ class I32tof32RahMem32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field mem32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {reg_a_field, mem32_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint16_t GetMem32(uint32_t data);
-  static uint32_t SetMem32(uint16_t mem32);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint16_t GetMem32(const uint32_t data) {
+    return mem32_field.Get(data);
+  }
+  static constexpr uint32_t SetMem32(const uint16_t mem32) {
+    return opcode | mem32_field.Set(mem32);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class I32tof32RahRbh final : public Instruction4Byte {
  public:
-  I32tof32RahRbh() : Instruction4Byte() {}
+  constexpr I32tof32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::I32TOF32_RAH_RBH;
@@ -14006,25 +17297,38 @@ class I32tof32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Macf32R3hR2hRdhRehRfh final : public Instruction4Byte {
  public:
-  Macf32R3hR2hRdhRehRfh() : Instruction4Byte() {}
+  constexpr Macf32R3hR2hRdhRehRfh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MACF32_R3H_R2H_RDH_REH_RFH;
@@ -14042,27 +17346,45 @@ class Macf32R3hR2hRdhRehRfh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_d_field = {9, 3, OPERAND_REGISTER};
+  static constexpr Field reg_e_field = {12, 3, OPERAND_REGISTER};
+  static constexpr Field reg_f_field = {15, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_d_field, reg_e_field, reg_f_field};
+
   /* Helper Functions */
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
-  static uint8_t GetRegE(uint32_t data);
-  static uint32_t SetRegE(uint8_t e);
-  static uint8_t GetRegF(uint32_t data);
-  static uint32_t SetRegF(uint8_t f);
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
+  static constexpr uint8_t GetRegE(const uint32_t data) {
+    return reg_e_field.Get(data);
+  }
+  static constexpr uint32_t SetRegE(const uint8_t e) {
+    return opcode | reg_e_field.Set(e);
+  }
+  static constexpr uint8_t GetRegF(const uint32_t data) {
+    return reg_f_field.Get(data);
+  }
+  static constexpr uint32_t SetRegF(const uint8_t f) {
+    return opcode | reg_f_field.Set(f);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Macf32R3hR2hRdhRehRfhMov32RahMem32 final : public Instruction4Byte {
  public:
-  Macf32R3hR2hRdhRehRfhMov32RahMem32() : Instruction4Byte() {}
+  constexpr Macf32R3hR2hRdhRehRfhMov32RahMem32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode =
@@ -14081,31 +17403,60 @@ class Macf32R3hR2hRdhRehRfhMov32RahMem32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field reg_d_field = {11, 3, OPERAND_REGISTER};
+  static constexpr Field reg_e_field = {14, 3, OPERAND_REGISTER};
+  static constexpr Field reg_f_field = {17, 3, OPERAND_REGISTER};
+  static constexpr Field mem32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {reg_a_field, reg_d_field, reg_e_field,
+                                        reg_f_field, mem32_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
-  static uint8_t GetRegE(uint32_t data);
-  static uint32_t SetRegE(uint8_t e);
-  static uint8_t GetRegF(uint32_t data);
-  static uint32_t SetRegF(uint8_t f);
-  static uint16_t GetMem32(uint32_t data);
-  static uint32_t SetMem32(uint16_t mem32);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
+  static constexpr uint8_t GetRegE(const uint32_t data) {
+    return reg_e_field.Get(data);
+  }
+  static constexpr uint32_t SetRegE(const uint8_t e) {
+    return opcode | reg_e_field.Set(e);
+  }
+  static constexpr uint8_t GetRegF(const uint32_t data) {
+    return reg_f_field.Get(data);
+  }
+  static constexpr uint32_t SetRegF(const uint8_t f) {
+    return opcode | reg_f_field.Set(f);
+  }
+  static constexpr uint16_t GetMem32(const uint32_t data) {
+    return mem32_field.Get(data);
+  }
+  static constexpr uint32_t SetMem32(const uint16_t mem32) {
+    return opcode | mem32_field.Set(mem32);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Macf32R7hR3hMem32Xar7Postinc final : public Instruction4Byte {
  public:
-  Macf32R7hR3hMem32Xar7Postinc() : Instruction4Byte() {}
+  constexpr Macf32R7hR3hMem32Xar7Postinc() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MACF32_R7H_R3H_MEM32_XAR7_POSTINC;
@@ -14123,23 +17474,31 @@ class Macf32R7hR3hMem32Xar7Postinc final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field mem32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {mem32_field};
+
   /* Helper Functions */
-  static uint16_t GetMem32(uint32_t data);
-  static uint32_t SetMem32(uint16_t mem32);
+  static constexpr uint16_t GetMem32(const uint32_t data) {
+    return mem32_field.Get(data);
+  }
+  static constexpr uint32_t SetMem32(const uint16_t mem32) {
+    return opcode | mem32_field.Set(mem32);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Macf32R7hR6hRdhRehRfh final : public Instruction4Byte {
  public:
-  Macf32R7hR6hRdhRehRfh() : Instruction4Byte() {}
+  constexpr Macf32R7hR6hRdhRehRfh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MACF32_R7H_R6H_RDH_REH_RFH;
@@ -14157,27 +17516,45 @@ class Macf32R7hR6hRdhRehRfh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_d_field = {9, 3, OPERAND_REGISTER};
+  static constexpr Field reg_e_field = {12, 3, OPERAND_REGISTER};
+  static constexpr Field reg_f_field = {15, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_d_field, reg_e_field, reg_f_field};
+
   /* Helper Functions */
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
-  static uint8_t GetRegE(uint32_t data);
-  static uint32_t SetRegE(uint8_t e);
-  static uint8_t GetRegF(uint32_t data);
-  static uint32_t SetRegF(uint8_t f);
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
+  static constexpr uint8_t GetRegE(const uint32_t data) {
+    return reg_e_field.Get(data);
+  }
+  static constexpr uint32_t SetRegE(const uint8_t e) {
+    return opcode | reg_e_field.Set(e);
+  }
+  static constexpr uint8_t GetRegF(const uint32_t data) {
+    return reg_f_field.Get(data);
+  }
+  static constexpr uint32_t SetRegF(const uint8_t f) {
+    return opcode | reg_f_field.Set(f);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Macf32R7hR6hRdhRehRfhMov32RahMem32 final : public Instruction4Byte {
  public:
-  Macf32R7hR6hRdhRehRfhMov32RahMem32() : Instruction4Byte() {}
+  constexpr Macf32R7hR6hRdhRehRfhMov32RahMem32() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode =
@@ -14196,31 +17573,60 @@ class Macf32R7hR6hRdhRehRfhMov32RahMem32 final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {8, 3, OPERAND_REGISTER};
+  static constexpr Field reg_d_field = {11, 3, OPERAND_REGISTER};
+  static constexpr Field reg_e_field = {14, 3, OPERAND_REGISTER};
+  static constexpr Field reg_f_field = {17, 3, OPERAND_REGISTER};
+  static constexpr Field mem32_field = {0, 8, OPERAND_LOC32};
+  static constexpr std::array fields = {reg_a_field, reg_d_field, reg_e_field,
+                                        reg_f_field, mem32_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
-  static uint8_t GetRegE(uint32_t data);
-  static uint32_t SetRegE(uint8_t e);
-  static uint8_t GetRegF(uint32_t data);
-  static uint32_t SetRegF(uint8_t f);
-  static uint16_t GetMem32(uint32_t data);
-  static uint32_t SetMem32(uint16_t mem32);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
+  static constexpr uint8_t GetRegE(const uint32_t data) {
+    return reg_e_field.Get(data);
+  }
+  static constexpr uint32_t SetRegE(const uint8_t e) {
+    return opcode | reg_e_field.Set(e);
+  }
+  static constexpr uint8_t GetRegF(const uint32_t data) {
+    return reg_f_field.Get(data);
+  }
+  static constexpr uint32_t SetRegF(const uint8_t f) {
+    return opcode | reg_f_field.Set(f);
+  }
+  static constexpr uint16_t GetMem32(const uint32_t data) {
+    return mem32_field.Get(data);
+  }
+  static constexpr uint32_t SetMem32(const uint16_t mem32) {
+    return opcode | mem32_field.Set(mem32);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Maxf32RahRbh final : public Instruction4Byte {
  public:
-  Maxf32RahRbh() : Instruction4Byte() {}
+  constexpr Maxf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAXF32_RAH_RBH;
@@ -14238,25 +17644,38 @@ class Maxf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Maxf32Rah16fhi final : public Instruction4Byte {
  public:
-  Maxf32Rah16fhi() : Instruction4Byte() {}
+  constexpr Maxf32Rah16fhi() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAXF32_RAH_16FHI;
@@ -14274,25 +17693,38 @@ class Maxf32Rah16fhi final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field fhi16_field = {3, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_a_field, fhi16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint16_t Get16fhi(uint32_t data);
-  static uint32_t Set16fhi(uint16_t i);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint16_t Get16fhi(const uint32_t data) {
+    return fhi16_field.Get(data);
+  }
+  static constexpr uint32_t Set16fhi(const uint16_t i) {
+    return opcode | fhi16_field.Set(i);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Maxf32RahRbhMov32RchRdh final : public Instruction4Byte {
  public:
-  Maxf32RahRbhMov32RchRdh() : Instruction4Byte() {}
+  constexpr Maxf32RahRbhMov32RchRdh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MAXF32_RAH_RBH_MOV32_RCH_RDH;
@@ -14310,29 +17742,53 @@ class Maxf32RahRbhMov32RchRdh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr Field reg_c_field = {6, 3, OPERAND_REGISTER};
+  static constexpr Field reg_d_field = {9, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field, reg_c_field,
+                                        reg_d_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
-  static uint8_t GetRegC(uint32_t data);
-  static uint32_t SetRegC(uint8_t c);
-  static uint8_t GetRegD(uint32_t data);
-  static uint32_t SetRegD(uint8_t d);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
+  static constexpr uint8_t GetRegC(const uint32_t data) {
+    return reg_c_field.Get(data);
+  }
+  static constexpr uint32_t SetRegC(const uint8_t c) {
+    return opcode | reg_c_field.Set(c);
+  }
+  static constexpr uint8_t GetRegD(const uint32_t data) {
+    return reg_d_field.Get(data);
+  }
+  static constexpr uint32_t SetRegD(const uint8_t d) {
+    return opcode | reg_d_field.Set(d);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Minf32RahRbh final : public Instruction4Byte {
  public:
-  Minf32RahRbh() : Instruction4Byte() {}
+  constexpr Minf32RahRbh() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MINF32_RAH_RBH;
@@ -14350,25 +17806,38 @@ class Minf32RahRbh final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field reg_b_field = {3, 3, OPERAND_REGISTER};
+  static constexpr std::array fields = {reg_a_field, reg_b_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint8_t GetRegB(uint32_t data);
-  static uint32_t SetRegB(uint8_t b);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint8_t GetRegB(const uint32_t data) {
+    return reg_b_field.Get(data);
+  }
+  static constexpr uint32_t SetRegB(const uint8_t b) {
+    return opcode | reg_b_field.Set(b);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
 
 class Minf32Rah16fhi final : public Instruction4Byte {
  public:
-  Minf32Rah16fhi() : Instruction4Byte() {}
+  constexpr Minf32Rah16fhi() : Instruction4Byte() {}
 
   /* Instruction Data */
   static constexpr uint32_t opcode = Opcodes::MINF32_RAH_16FHI;
@@ -14386,18 +17855,31 @@ class Minf32Rah16fhi final : public Instruction4Byte {
   bool IsRepeatable() override { return repeatable; }
   ObjectMode GetObjmode() override { return objmode; }
 
+  /* Operand Fields */
+  static constexpr Field reg_a_field = {0, 3, OPERAND_REGISTER};
+  static constexpr Field fhi16_field = {3, 16, OPERAND_CONSTANT};
+  static constexpr std::array fields = {reg_a_field, fhi16_field};
+
   /* Helper Functions */
-  static uint8_t GetRegA(uint32_t data);
-  static uint32_t SetRegA(uint8_t a);
-  static uint16_t Get16fhi(uint32_t data);
-  static uint32_t Set16fhi(uint16_t i);
+  static constexpr uint8_t GetRegA(const uint32_t data) {
+    return reg_a_field.Get(data);
+  }
+  static constexpr uint32_t SetRegA(const uint8_t a) {
+    return opcode | reg_a_field.Set(a);
+  }
+  static constexpr uint16_t Get16fhi(const uint32_t data) {
+    return fhi16_field.Get(data);
+  }
+  static constexpr uint32_t Set16fhi(const uint16_t i) {
+    return opcode | fhi16_field.Set(i);
+  }
 
   /* Binary Ninja Function Implementations */
-  // bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           std::vector<BN::InstructionTextToken>& result,
   //           AddressMode amode) override;
 
-  // bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+  // bool Lift(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
   //           BN::LowLevelILFunction& il, TIC28XArchitecture* arch) override;
   //
 };
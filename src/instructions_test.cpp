@@ -27,7 +27,7 @@ std::vector<std::tuple<unsigned int, std::string, TIC28X::ObjectMode>>
 GenerateTestOpcodes() {
   std::vector<std::tuple<unsigned int, std::string, TIC28X::ObjectMode>>
       opcodes = {
-          {0xFFFFFFFF, "NULLOPT", TIC28X::OBJMODE_ANY},
+          {0xFFFFFFFF, "NULLPTR", TIC28X::OBJMODE_ANY},
           {TIC28X::Aborti::opcode, TIC28X::Aborti::full_name,
            TIC28X::Aborti::objmode},
           {TIC28X::AbsAcc::opcode, TIC28X::AbsAcc::full_name,
@@ -1140,15 +1140,14 @@ TEST_P(TestDecodeInstructions, TestDecode) {
     };
   }
 
-  const auto instructions = TIC28X::GenerateInstructionVector();
-  const auto i =
-      TIC28X::DecodeInstruction(full_op.data(), instructions, objmode);
+  const auto i = TIC28X::DecodeInstruction(
+      full_op.data(), TIC28X::GetInstructions(), objmode);
 
-  if (want == "NULLOPT") {
-    EXPECT_EQ(std::nullopt, i);
+  if (want == "NULLPTR") {
+    EXPECT_EQ(nullptr, i);
   } else {
-    EXPECT_NE(i, std::nullopt);  // guard against segfault
-    EXPECT_EQ(want, i->get()->GetFullName());
+    ASSERT_NE(i, nullptr);  // guard against segfault
+    EXPECT_EQ(want, i->GetFullName());
   }
 }
 
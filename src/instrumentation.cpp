@@ -0,0 +1,245 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace TIC28X::Instrumentation {
+namespace {
+/**
+ * Counter - a count that only its own thread writes. A relaxed load and
+ * store is enough for the owner, and much cheaper than an atomic increment;
+ * other threads only ever read it.
+ */
+class Counter {
+ public:
+  void Add(const uint64_t n) {
+    VALUE.store(VALUE.load(std::memory_order_relaxed) + n,
+                std::memory_order_relaxed);
+  }
+  [[nodiscard]] uint64_t Get() const {
+    return VALUE.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint64_t> VALUE = 0;
+};
+
+struct ThreadCounters {
+  std::array<Counter, CALLBACK_COUNT> calls;
+  std::array<Counter, CALLBACK_COUNT> total_ns;
+  std::array<std::array<Counter, LATENCY_BUCKETS>, CALLBACK_COUNT> latency;
+  std::array<Counter, EVENT_COUNT> events;
+  std::array<Counter, DEPTH_BUCKETS> decode_depth;
+  std::array<Counter, Registry::COUNT> instructions;
+  std::array<std::array<Counter, LOC_KIND_COUNT>, 2> loc_modes;
+};
+
+// Every thread's counters. Blocks are never freed, so the counts of analysis
+// threads that have exited (or outlive plugin unload) are kept.
+struct Threads {
+  std::mutex mutex;
+  std::vector<ThreadCounters*> counters;
+};
+
+Threads& GetThreads() {
+  static auto* threads = new Threads();
+  return *threads;
+}
+
+ThreadCounters& GetLocal() {
+  thread_local ThreadCounters* local = [] {
+    auto* counters = new ThreadCounters();
+    auto& threads = GetThreads();
+    std::lock_guard lock(threads.mutex);
+    threads.counters.push_back(counters);
+    return counters;
+  }();
+  return *local;
+}
+
+constexpr std::array<const char*, CALLBACK_COUNT> CALLBACK_NAMES = {
+    "get_instruction_info",
+    "get_instruction_text",
+    "get_instruction_low_level_il",
+    "decode",
+};
+
+constexpr std::array<const char*, EVENT_COUNT> EVENT_NAMES = {
+    "text_cache_hits", "text_cache_misses", "invalid_opcodes",
+};
+
+template <size_t N>
+void AppendArray(std::string& out, const std::array<uint64_t, N>& values) {
+  out += '[';
+  for (size_t i = 0; i < N; i++) {
+    out += i ? ", " : "";
+    out += std::to_string(values[i]);
+  }
+  out += ']';
+}
+
+// Writes the snapshot to the file named by TIC28X_INSTRUMENTATION_FILE, if
+// set, when the plugin unloads or the process exits
+struct DumpOnUnload {
+  ~DumpOnUnload() {
+    if (const char* path = std::getenv("TIC28X_INSTRUMENTATION_FILE")) {
+      WriteJson(path);
+    }
+  }
+};
+
+#ifdef TIC28X_INSTRUMENTATION
+const DumpOnUnload DUMP_ON_UNLOAD;
+#endif
+}  // namespace
+
+/**
+ * Count - counts one occurrence of an event on the calling thread.
+ *
+ * @param event - event that happened
+ */
+void Count(const Event event) { GetLocal().events[event].Add(1); }
+
+/**
+ * RecordLatency - records one call of a callback on the calling thread.
+ *
+ * @param callback - callback that was called
+ * @param ns - how long the call took, in nanoseconds
+ */
+void RecordLatency(const Callback callback, const uint64_t ns) {
+  auto& local = GetLocal();
+  const size_t bucket =
+      std::min<size_t>(ns ? std::bit_width(ns) - 1 : 0, LATENCY_BUCKETS - 1);
+  local.calls[callback].Add(1);
+  local.total_ns[callback].Add(ns);
+  local.latency[callback][bucket].Add(1);
+}
+
+/**
+ * RecordDecodeDepth - records how far into a decode table chain a decode had
+ * to look.
+ *
+ * @param depth - chain nodes walked, 0 for a first-level hit
+ */
+void RecordDecodeDepth(const size_t depth) {
+  GetLocal().decode_depth[std::min(depth, DEPTH_BUCKETS - 1)].Add(1);
+}
+
+/**
+ * RecordDecode - profiles one decoded instruction (see Profile::Add).
+ *
+ * @param id - instruction id
+ * @param word - opcode, as built by DataToOpcode
+ * @param amode - current addressing mode
+ */
+void RecordDecode(const uint16_t id, const uint32_t word,
+                  const AddressMode amode) {
+  auto& local = GetLocal();
+  local.instructions[id].Add(1);
+  VisitLocModes(id, word, amode, [&local](const bool is_loc32,
+                                          const LocKind kind) {
+    local.loc_modes[is_loc32][kind].Add(1);
+  });
+}
+
+/**
+ * Collect - sums the counters of every thread. Threads may keep recording
+ * while this runs, so the totals are only consistent to within a few calls.
+ *
+ * @return totals across threads
+ */
+Snapshot Collect() {
+  Snapshot snapshot = {};
+  auto& threads = GetThreads();
+  std::lock_guard lock(threads.mutex);
+  for (const auto* counters : threads.counters) {
+    for (size_t c = 0; c < CALLBACK_COUNT; c++) {
+      snapshot.calls[c] += counters->calls[c].Get();
+      snapshot.total_ns[c] += counters->total_ns[c].Get();
+      for (size_t b = 0; b < LATENCY_BUCKETS; b++) {
+        snapshot.latency[c][b] += counters->latency[c][b].Get();
+      }
+    }
+    for (size_t e = 0; e < EVENT_COUNT; e++) {
+      snapshot.events[e] += counters->events[e].Get();
+    }
+    for (size_t d = 0; d < DEPTH_BUCKETS; d++) {
+      snapshot.decode_depth[d] += counters->decode_depth[d].Get();
+    }
+    for (size_t id = 0; id < Registry::COUNT; id++) {
+      snapshot.profile.instructions[id] += counters->instructions[id].Get();
+    }
+    for (const bool is_loc32 : {false, true}) {
+      for (size_t kind = 0; kind < LOC_KIND_COUNT; kind++) {
+        snapshot.profile.loc_modes[is_loc32][kind] +=
+            counters->loc_modes[is_loc32][kind].Get();
+      }
+    }
+  }
+  snapshot.threads = threads.counters.size();
+  return snapshot;
+}
+
+/**
+ * ToJson - renders a snapshot as a JSON object:
+ *  - callbacks: calls, total_ns and latency_log2_ns (bucket i counts calls
+ *    that took [2^i, 2^(i+1)) ns) of each callback
+ *  - events: count of each event
+ *  - decode_depth: decodes by decode table chain nodes walked
+ *  - profile: decodes by instruction class and addressing mode (see
+ *    Profile::ToJson)
+ *  - threads: number of threads that recorded anything
+ *
+ * @param snapshot - totals to render
+ * @return JSON text
+ */
+std::string ToJson(const Snapshot& snapshot) {
+  std::string out = "{\n  \"callbacks\": {\n";
+  for (size_t c = 0; c < CALLBACK_COUNT; c++) {
+    out += "    \"";
+    out += CALLBACK_NAMES[c];
+    out += "\": {\"calls\": " + std::to_string(snapshot.calls[c]);
+    out += ", \"total_ns\": " + std::to_string(snapshot.total_ns[c]);
+    out += ", \"latency_log2_ns\": ";
+    AppendArray(out, snapshot.latency[c]);
+    out += c + 1 < CALLBACK_COUNT ? "},\n" : "}\n";
+  }
+  out += "  },\n  \"events\": {\n";
+  for (size_t e = 0; e < EVENT_COUNT; e++) {
+    out += "    \"";
+    out += EVENT_NAMES[e];
+    out += "\": " + std::to_string(snapshot.events[e]);
+    out += e + 1 < EVENT_COUNT ? ",\n" : "\n";
+  }
+  out += "  },\n  \"decode_depth\": ";
+  AppendArray(out, snapshot.decode_depth);
+  out += ",\n  \"profile\": " + snapshot.profile.ToJson(2);
+  out += ",\n  \"threads\": " + std::to_string(snapshot.threads) + "\n}\n";
+  return out;
+}
+
+/**
+ * WriteJson - writes the current totals to a file as JSON (see ToJson).
+ *
+ * @param path - file to write
+ * @return true if the whole file was written
+ */
+bool WriteJson(const char* path) {
+  std::FILE* file = std::fopen(path, "w");
+  if (!file) {
+    return false;
+  }
+  const std::string json = ToJson(Collect());
+  const bool written = std::fwrite(json.data(), 1, json.size(), file) ==
+                       json.size();
+  return std::fclose(file) == 0 && written;
+}
+}  // namespace TIC28X::Instrumentation
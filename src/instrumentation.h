@@ -0,0 +1,122 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_INSTRUMENTATION_H
+#define TIC28X_INSTRUMENTATION_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "profile.h"
+
+namespace TIC28X::Instrumentation {
+/**
+ * Instrumentation - opt-in counters and latency histograms for the
+ * architecture callbacks, for finding where analysis time goes.
+ *
+ * Every thread records into its own block of counters, so recording never
+ * contends or takes a lock; Collect sums the blocks of every thread that has
+ * recorded anything. The plugin only compiles and calls the functions here
+ * when built with the TIC28X_INSTRUMENTATION CMake option (see the
+ * TIC28X_TIME and TIC28X_COUNT macros), so normal builds pay nothing.
+ *
+ * Decodes are also profiled by instruction class and addressing mode (see
+ * Profile), which is how a whole analysis session's histogram is exported.
+ * Every decode a callback asks for counts, so instructions are weighted by
+ * how often Binary Ninja asks about them rather than by how often they occur
+ * in the binary.
+ */
+
+// Callbacks whose latency is recorded
+enum Callback : uint8_t {
+  CALLBACK_INFO,    // GetInstructionInfo
+  CALLBACK_TEXT,    // GetInstructionText
+  CALLBACK_LIFT,    // GetInstructionLowLevelIL
+  CALLBACK_DECODE,  // Decode
+  CALLBACK_COUNT,
+};
+
+// Events that are counted
+enum Event : uint8_t {
+  EVENT_TEXT_CACHE_HIT,
+  EVENT_TEXT_CACHE_MISS,
+  EVENT_INVALID_OPCODE,  // bytes that decode to no instruction
+  EVENT_COUNT,
+};
+
+// Latency bucket i counts calls that took [2^i, 2^(i+1)) ns; the first
+// bucket also holds 0 ns and the last everything longer
+constexpr size_t LATENCY_BUCKETS = 32;
+
+// Decode depth d counts decodes resolved after walking d nodes of a decode
+// table chain (0 is a first-level hit); the last bucket holds deeper ones
+constexpr size_t DEPTH_BUCKETS = 16;
+
+/**
+ * Snapshot - the totals of every thread at one point in time.
+ */
+struct Snapshot {
+  std::array<uint64_t, CALLBACK_COUNT> calls;
+  std::array<uint64_t, CALLBACK_COUNT> total_ns;
+  std::array<std::array<uint64_t, LATENCY_BUCKETS>, CALLBACK_COUNT> latency;
+  std::array<uint64_t, EVENT_COUNT> events;
+  std::array<uint64_t, DEPTH_BUCKETS> decode_depth;
+  Profile profile;  // callback decodes by instruction and addressing mode
+  size_t threads;  // threads that have recorded anything
+};
+
+void Count(Event event);
+void RecordLatency(Callback callback, uint64_t ns);
+void RecordDecodeDepth(size_t depth);
+void RecordDecode(uint16_t id, uint32_t word, AddressMode amode);
+
+Snapshot Collect();
+std::string ToJson(const Snapshot& snapshot);
+bool WriteJson(const char* path);
+
+/**
+ * ScopedTimer - records the latency of a callback from construction to
+ * destruction.
+ */
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(const Callback callback)
+      : CALLBACK(callback), START(std::chrono::steady_clock::now()) {}
+  ~ScopedTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - START;
+    RecordLatency(
+        CALLBACK,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  const Callback CALLBACK;
+  const std::chrono::steady_clock::time_point START;
+};
+}  // namespace TIC28X::Instrumentation
+
+// Hooks for the hot paths; they compile to nothing unless the plugin is built
+// with instrumentation
+#ifdef TIC28X_INSTRUMENTATION
+#define TIC28X_TIME(callback)                                  \
+  const ::TIC28X::Instrumentation::ScopedTimer tic28x_timer_( \
+      ::TIC28X::Instrumentation::callback)
+#define TIC28X_COUNT(event) \
+  ::TIC28X::Instrumentation::Count(::TIC28X::Instrumentation::event)
+#define TIC28X_DECODE_DEPTH(depth) \
+  ::TIC28X::Instrumentation::RecordDecodeDepth(depth)
+#define TIC28X_PROFILE_DECODE(decoded, amode) \
+  ::TIC28X::Instrumentation::RecordDecode((decoded).id, (decoded).word, amode)
+#else
+#define TIC28X_TIME(callback) static_cast<void>(0)
+#define TIC28X_COUNT(event) static_cast<void>(0)
+#define TIC28X_DECODE_DEPTH(depth) static_cast<void>(0)
+#define TIC28X_PROFILE_DECODE(decoded, amode) static_cast<void>(0)
+#endif
+
+#endif  // TIC28X_INSTRUMENTATION_H
@@ -0,0 +1,111 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "instrumentation.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "architecture.h"
+#include "instructions.h"
+#include "registry.h"
+
+namespace Inst = TIC28X::Instrumentation;
+
+// Verify that counts from several threads are summed, and land in the right
+// latency and depth buckets
+TEST(TestInstrumentation, CollectAcrossThreads) {
+  const auto before = Inst::Collect();
+
+  Inst::Count(Inst::EVENT_INVALID_OPCODE);
+  std::thread([] {
+    Inst::Count(Inst::EVENT_INVALID_OPCODE);
+    Inst::RecordLatency(Inst::CALLBACK_LIFT, 0);     // bucket 0
+    Inst::RecordLatency(Inst::CALLBACK_LIFT, 1000);  // bucket 9
+    Inst::RecordDecodeDepth(2);
+    Inst::RecordDecodeDepth(100);  // last bucket
+  }).join();
+
+  const auto after = Inst::Collect();
+  EXPECT_EQ(after.events[Inst::EVENT_INVALID_OPCODE] -
+                before.events[Inst::EVENT_INVALID_OPCODE],
+            2u);
+  EXPECT_EQ(
+      after.calls[Inst::CALLBACK_LIFT] - before.calls[Inst::CALLBACK_LIFT], 2u);
+  EXPECT_EQ(after.total_ns[Inst::CALLBACK_LIFT] -
+                before.total_ns[Inst::CALLBACK_LIFT],
+            1000u);
+  EXPECT_EQ(after.latency[Inst::CALLBACK_LIFT][0] -
+                before.latency[Inst::CALLBACK_LIFT][0],
+            1u);
+  EXPECT_EQ(after.latency[Inst::CALLBACK_LIFT][9] -
+                before.latency[Inst::CALLBACK_LIFT][9],
+            1u);
+  EXPECT_EQ(after.decode_depth[2] - before.decode_depth[2], 1u);
+  EXPECT_EQ(after.decode_depth[Inst::DEPTH_BUCKETS - 1] -
+                before.decode_depth[Inst::DEPTH_BUCKETS - 1],
+            1u);
+  // The exited thread's counts are kept
+  EXPECT_GE(after.threads, before.threads + 1);
+}
+
+// Verify the JSON layout
+TEST(TestInstrumentation, Json) {
+  Inst::Snapshot snapshot = {};
+  snapshot.calls[Inst::CALLBACK_TEXT] = 3;
+  snapshot.events[Inst::EVENT_TEXT_CACHE_HIT] = 7;
+  snapshot.decode_depth[1] = 5;
+  snapshot.threads = 2;
+
+  const auto json = Inst::ToJson(snapshot);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_NE(json.find("\"get_instruction_text\": {\"calls\": 3, "
+                      "\"total_ns\": 0, \"latency_log2_ns\": [0, 0"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"text_cache_hits\": 7,"), std::string::npos);
+  EXPECT_NE(json.find("\"decode_depth\": [0, 5, 0"), std::string::npos);
+  EXPECT_NE(json.find("\"profile\": {\n    \"decodes\": 0,"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"threads\": 2\n}"), std::string::npos);
+}
+
+// Verify that the architecture callbacks are counted in instrumented builds
+TEST(TestInstrumentation, ArchitectureCallbacks) {
+#ifndef TIC28X_INSTRUMENTATION
+  GTEST_SKIP() << "built without TIC28X_INSTRUMENTATION";
+#endif
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1);
+  const uint16_t nop = TIC28X::NopIndArpn::SetInd(0xB8);  // NOP *
+  const std::array<uint8_t, 2> data = {static_cast<uint8_t>(nop & 0xFF),
+                                       static_cast<uint8_t>(nop >> 8)};
+  const std::array<uint8_t, 2> invalid = {0xFF, 0xFF};
+
+  const auto before = Inst::Collect();
+  BN::InstructionInfo info;
+  ASSERT_TRUE(arch->GetInstructionInfo(data.data(), 0x100, 2, info));
+  size_t len = 0;
+  std::vector<BN::InstructionTextToken> tokens;
+  ASSERT_TRUE(arch->GetInstructionText(data.data(), 0x100, len, tokens));
+  arch->GetInstructionInfo(invalid.data(), 0x200, 2, info);
+  const auto after = Inst::Collect();
+
+  const auto delta = [&](const auto member, const size_t i) {
+    return (after.*member)[i] - (before.*member)[i];
+  };
+  EXPECT_EQ(delta(&Inst::Snapshot::calls, Inst::CALLBACK_INFO), 2u);
+  EXPECT_EQ(delta(&Inst::Snapshot::calls, Inst::CALLBACK_TEXT), 1u);
+  EXPECT_EQ(delta(&Inst::Snapshot::calls, Inst::CALLBACK_DECODE), 3u);
+  EXPECT_EQ(delta(&Inst::Snapshot::events, Inst::EVENT_INVALID_OPCODE), 1u);
+  EXPECT_EQ(delta(&Inst::Snapshot::decode_depth, 0), 2u);
+  // Each callback's decode is profiled
+  const uint16_t id = TIC28X::Registry::ID<TIC28X::NopIndArpn>;
+  EXPECT_EQ(after.profile.instructions[id] - before.profile.instructions[id],
+            2u);
+  EXPECT_EQ(after.profile.Total() - before.profile.Total(), 2u);
+}
@@ -9,8 +9,9 @@
 
 namespace TIC28X {
 // Default constructor (temporary for testing -- TODO: delete this)
-bool Instruction::Lift(const uint8_t* data, uint64_t addr, size_t& len,
-                       BN::LowLevelILFunction& il, TIC28XArchitecture* arch) {
+bool Instruction::Lift(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len, BN::LowLevelILFunction& il,
+                       TIC28XArchitecture* arch) {
   return false;
 }
 
@@ -0,0 +1,154 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "profile.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace TIC28X {
+namespace {
+constexpr std::array<const char*, LOC_KIND_COUNT> LOC_KIND_NAMES = {
+    "invalid",         "dp_direct",       "dp_direct_7bit",
+    "sp_offset",       "sp_postinc",      "sp_predec",
+    "xarn_postinc",    "xarn_predec",     "xarn_indexed",
+    "xarn_offset",     "arp",             "arp_postinc",
+    "arp_postdec",     "arp_ar0_postinc", "arp_ar0_postdec",
+    "arp_br0_postinc", "arp_br0_postdec", "circular",
+    "circular_indexed", "register",
+};
+}  // namespace
+
+/**
+ * Add - counts one decode of an instruction and of its loc16/loc32 operands.
+ *
+ * @param id - instruction id
+ * @param word - opcode, as built by DataToOpcode
+ * @param amode - current addressing mode
+ */
+void Profile::Add(const uint16_t id, const uint32_t word,
+                  const AddressMode amode) {
+  instructions[id]++;
+  VisitLocModes(id, word, amode, [this](const bool is_loc32,
+                                        const LocKind kind) {
+    loc_modes[is_loc32][kind]++;
+  });
+}
+
+/**
+ * Total - counts every decode in the profile.
+ *
+ * @return number of decodes
+ */
+uint64_t Profile::Total() const {
+  return std::accumulate(instructions.begin(), instructions.end(),
+                         uint64_t{0});
+}
+
+/**
+ * Hottest - lists the most frequently decoded instruction classes.
+ *
+ * @param n - most ids to return
+ * @param cacheable_only - skip classes whose text cannot be cached (see
+ * Registry::ADDRESS_INDEPENDENT)
+ * @return ids of decoded classes, hottest first; ties keep registry order
+ */
+std::vector<uint16_t> Profile::Hottest(const size_t n,
+                                       const bool cacheable_only) const {
+  std::vector<uint16_t> ids;
+  for (uint16_t id = 0; id < Registry::COUNT; id++) {
+    if (instructions[id] &&
+        (!cacheable_only || Registry::ADDRESS_INDEPENDENT[id])) {
+      ids.push_back(id);
+    }
+  }
+  std::stable_sort(ids.begin(), ids.end(), [this](const auto a, const auto b) {
+    return instructions[a] > instructions[b];
+  });
+  ids.resize(std::min(n, ids.size()));
+  return ids;
+}
+
+/**
+ * ToJson - renders the profile as a JSON object:
+ *  - decodes: total decodes
+ *  - instructions: decodes of each decoded class by full name, hottest first
+ *  - loc16, loc32: operands of each addressing mode
+ *
+ * @param indent - spaces to indent every line after the first by, for
+ * nesting in another object
+ * @return JSON text, without a trailing newline
+ */
+std::string Profile::ToJson(const size_t indent) const {
+  const std::string pad(indent, ' ');
+  std::string out = "{\n" + pad + "  \"decodes\": " + std::to_string(Total());
+  out += ",\n" + pad + "  \"instructions\": {";
+  const auto hottest = Hottest(Registry::COUNT, false);
+  for (size_t i = 0; i < hottest.size(); i++) {
+    out += i ? ",\n" : "\n";
+    out += pad + "    \"";
+    out += Registry::FULL_NAMES[hottest[i]];
+    out += "\": " + std::to_string(instructions[hottest[i]]);
+  }
+  out += hottest.empty() ? "}" : "\n" + pad + "  }";
+  for (const bool is_loc32 : {false, true}) {
+    out += ",\n" + pad + (is_loc32 ? "  \"loc32\": {\n" : "  \"loc16\": {\n");
+    for (size_t kind = 0; kind < LOC_KIND_COUNT; kind++) {
+      out += pad + "    \"";
+      out += LOC_KIND_NAMES[kind];
+      out += "\": " + std::to_string(loc_modes[is_loc32][kind]);
+      out += kind + 1 < LOC_KIND_COUNT ? ",\n" : "\n";
+    }
+    out += pad + "  }";
+  }
+  out += "\n" + pad + "}";
+  return out;
+}
+
+/**
+ * ToHeader - renders the hottest cacheable classes in the format of
+ * src/hot_instructions.h, to feed the profile back into the build.
+ *
+ * @param n - most classes to list
+ * @return header text
+ */
+std::string Profile::ToHeader(const size_t n) const {
+  const auto hottest = Hottest(n, true);
+  std::string out =
+      "// Copyright (c) 2025. Battelle Energy Alliance, LLC\n"
+      "// ALL RIGHTS RESERVED\n"
+      "\n"
+      "#ifndef TIC28X_HOT_INSTRUCTIONS_H\n"
+      "#define TIC28X_HOT_INSTRUCTIONS_H\n"
+      "\n"
+      "#include <array>\n"
+      "\n"
+      "namespace TIC28X {\n"
+      "/**\n"
+      " * HOT_INSTRUCTIONS - the instruction classes (by full name) whose text "
+      "cache\n"
+      " * entries are kept when colder encodings collide with them (see\n"
+      " * TextCache::Insert), hottest first.\n"
+      " *\n"
+      " * Generated from a decode profile by\n"
+      " * `tic28x_profile --header src/hot_instructions.h <binary>`; rerun it "
+      "on\n"
+      " * representative firmware to regenerate. Only address independent "
+      "classes\n"
+      " * are listed, since only their text is cached.\n"
+      " */\n"
+      "inline constexpr std::array<const char*, ";
+  out += std::to_string(hottest.size()) + "> HOT_INSTRUCTIONS = {\n";
+  for (const auto id : hottest) {
+    out += "    \"";
+    out += Registry::FULL_NAMES[id];
+    out += "\",\n";
+  }
+  out +=
+      "};\n"
+      "}  // namespace TIC28X\n"
+      "\n"
+      "#endif  // TIC28X_HOT_INSTRUCTIONS_H\n";
+  return out;
+}
+}  // namespace TIC28X
@@ -0,0 +1,61 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_PROFILE_H
+#define TIC28X_PROFILE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "addressing.h"
+#include "registry.h"
+
+namespace TIC28X {
+/**
+ * Profile - histogram of decoded instruction classes and of the addressing
+ * modes of their loc16/loc32 operands.
+ *
+ * A profile is built over a raw binary by the tic28x_profile tool, or over a
+ * whole analysis session by an instrumented build (see instrumentation.h).
+ * Its hottest address independent classes are what src/hot_instructions.h
+ * lists for the text cache to keep.
+ */
+struct Profile {
+  std::array<uint64_t, Registry::COUNT> instructions;  // decodes by id
+  // Operands by width (0 = loc16, 1 = loc32) and LocKind
+  std::array<std::array<uint64_t, LOC_KIND_COUNT>, 2> loc_modes;
+
+  void Add(uint16_t id, uint32_t word, AddressMode amode);
+  [[nodiscard]] uint64_t Total() const;
+  [[nodiscard]] std::vector<uint16_t> Hottest(size_t n,
+                                              bool cacheable_only) const;
+  [[nodiscard]] std::string ToJson(size_t indent = 0) const;
+  [[nodiscard]] std::string ToHeader(size_t n) const;
+};
+
+/**
+ * VisitLocModes - calls visit(is_loc32, kind) for every loc16/loc32 operand
+ * of an instruction.
+ *
+ * @param id - instruction id
+ * @param word - opcode, as built by DataToOpcode
+ * @param amode - current addressing mode
+ * @param visit - callback
+ */
+template <class Visit>
+void VisitLocModes(const uint16_t id, const uint32_t word,
+                   const AddressMode amode, Visit&& visit) {
+  for (const auto& field : Registry::FIELDS[id]) {
+    if (field.kind == OPERAND_LOC16 || field.kind == OPERAND_LOC32) {
+      const auto& mode =
+          GetLocMode(static_cast<uint8_t>(field.Get(word)), amode, field.kind);
+      visit(field.kind == OPERAND_LOC32, mode.kind);
+    }
+  }
+}
+}  // namespace TIC28X
+
+#endif  // TIC28X_PROFILE_H
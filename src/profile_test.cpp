@@ -0,0 +1,84 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "profile.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "instructions.h"
+#include "registry.h"
+
+using TIC28X::Registry;
+
+namespace {
+// MOVL XAR4,*SP++ twice, LRETR and SB 0,UNC once each
+TIC28X::Profile SampleProfile() {
+  TIC28X::Profile profile = {};
+  const uint32_t movl = TIC28X::MovlXar4Loc32::SetLoc32(0xBD);  // *SP++
+  profile.Add(Registry::ID<TIC28X::MovlXar4Loc32>, movl, TIC28X::AMODE_0);
+  profile.Add(Registry::ID<TIC28X::MovlXar4Loc32>, movl, TIC28X::AMODE_0);
+  profile.Add(Registry::ID<TIC28X::Lretr>, TIC28X::Lretr::opcode,
+              TIC28X::AMODE_0);
+  profile.Add(Registry::ID<TIC28X::SbOff8Cond>, TIC28X::SbOff8Cond::opcode,
+              TIC28X::AMODE_0);
+  return profile;
+}
+}  // namespace
+
+// Verify that instructions and their loc32 operands are counted, and that the
+// hottest classes come first
+TEST(TestProfile, CountsAndHottest) {
+  const auto profile = SampleProfile();
+  EXPECT_EQ(profile.Total(), 4u);
+  EXPECT_EQ(profile.instructions[Registry::ID<TIC28X::MovlXar4Loc32>], 2u);
+  EXPECT_EQ(profile.loc_modes[1][TIC28X::LOC_SP_POSTINC], 2u);
+  for (const auto count : profile.loc_modes[0]) {
+    EXPECT_EQ(count, 0u);
+  }
+
+  const auto all = profile.Hottest(Registry::COUNT, false);
+  ASSERT_EQ(all.size(), 3u);
+  EXPECT_EQ(all[0], Registry::ID<TIC28X::MovlXar4Loc32>);
+  // Ties keep registry order
+  EXPECT_LT(all[1], all[2]);
+
+  // SB is PC-relative, so its text is never cached
+  const auto cacheable = profile.Hottest(Registry::COUNT, true);
+  ASSERT_EQ(cacheable.size(), 2u);
+  EXPECT_EQ(cacheable[1], Registry::ID<TIC28X::Lretr>);
+  EXPECT_EQ(profile.Hottest(1, true).size(), 1u);
+}
+
+// Verify the JSON layout
+TEST(TestProfile, Json) {
+  const auto json = SampleProfile().ToJson();
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_NE(json.find("\"decodes\": 4,\n  \"instructions\": {\n"
+                      "    \"MovlXar4Loc32\": 2,\n"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"Lretr\": 1"), std::string::npos);
+  EXPECT_NE(json.find("\"loc32\": {\n    \"invalid\": 0,"), std::string::npos);
+  EXPECT_NE(json.find("\"sp_postinc\": 2"), std::string::npos);
+  EXPECT_EQ(json.back(), '}');
+
+  EXPECT_EQ(TIC28X::Profile{}.ToJson().find("\"instructions\": {},"),
+            std::string("{\n  \"decodes\": 0,\n  ").size());
+}
+
+// Verify that the generated header lists the hottest cacheable classes in
+// the format of hot_instructions.h
+TEST(TestProfile, Header) {
+  const auto header = SampleProfile().ToHeader(16);
+  EXPECT_NE(header.find("std::array<const char*, 2> HOT_INSTRUCTIONS = {\n"
+                        "    \"MovlXar4Loc32\",\n"
+                        "    \"Lretr\",\n"
+                        "};\n"),
+            std::string::npos);
+  EXPECT_EQ(header.find("SbOff8Cond"), std::string::npos);
+  EXPECT_NE(header.find(" * Generated from a decode profile by\n"),
+            std::string::npos);
+  EXPECT_NE(header.find("#endif  // TIC28X_HOT_INSTRUCTIONS_H\n"),
+            std::string::npos);
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+/**
+ * profile - histogram of the instruction classes and loc16/loc32 addressing
+ * modes in raw code images, for deciding what the plugin should favour.
+ *
+ * Each image is swept linearly from its first byte (see DecodeRange), so it
+ * should hold code only; invalid halfwords are skipped and not counted. The
+ * histogram is printed as JSON (see Profile::ToJson). An instrumented build
+ * exports the same histogram for a whole analysis session instead.
+ *
+ * Usage: tic28x_profile [--objmode 0|1] [--amode 0|1] [--header path]
+ *                       [--top n] image...
+ * With --header, the hottest n (default 16) address independent classes are
+ * also written in the format of src/hot_instructions.h, the list the text
+ * cache pins; point it at that file and rebuild to use the profile.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "decoder.h"
+#include "profile.h"
+#include "sweep.h"
+
+namespace {
+bool ReadFile(const char* path, std::vector<uint8_t>& data) {
+  std::FILE* file = std::fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  data.clear();
+  uint8_t buf[1 << 16];
+  size_t n;
+  while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) {
+    data.insert(data.end(), buf, buf + n);
+  }
+  const bool ok = !std::ferror(file);
+  std::fclose(file);
+  return ok;
+}
+
+bool WriteFile(const char* path, const std::string& text) {
+  std::FILE* file = std::fopen(path, "w");
+  if (!file) {
+    return false;
+  }
+  const bool written =
+      std::fwrite(text.data(), 1, text.size(), file) == text.size();
+  return std::fclose(file) == 0 && written;
+}
+
+int Usage() {
+  std::fprintf(stderr,
+               "usage: tic28x_profile [--objmode 0|1] [--amode 0|1] "
+               "[--header path] [--top n] image...\n");
+  return 2;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  auto objmode = TIC28X::OBJMODE_1;
+  auto amode = TIC28X::AMODE_0;
+  const char* header = nullptr;
+  size_t top = 16;
+  std::vector<const char*> images;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--objmode" && has_value) {
+      objmode = std::atoi(argv[++i]) ? TIC28X::OBJMODE_1 : TIC28X::OBJMODE_0;
+    } else if (arg == "--amode" && has_value) {
+      amode = std::atoi(argv[++i]) ? TIC28X::AMODE_1 : TIC28X::AMODE_0;
+    } else if (arg == "--header" && has_value) {
+      header = argv[++i];
+    } else if (arg == "--top" && has_value) {
+      top = std::strtoul(argv[++i], nullptr, 0);
+    } else if (arg.starts_with("--")) {
+      return Usage();
+    } else {
+      images.push_back(argv[i]);
+    }
+  }
+  if (images.empty()) {
+    return Usage();
+  }
+
+  TIC28X::Profile profile = {};
+  std::vector<uint8_t> data;
+  TIC28X::DecodeRecords records;
+  for (const char* path : images) {
+    if (!ReadFile(path, data)) {
+      std::fprintf(stderr, "could not read %s\n", path);
+      return 1;
+    }
+    TIC28X::DecodeRange(data.data(), data.size(), 0, objmode, records);
+    for (size_t i = 0; i < records.Size(); i++) {
+      if (records.ids[i] != TIC28X::DecodeTable::INVALID) {
+        profile.Add(records.ids[i], records.words[i], amode);
+      }
+    }
+  }
+
+  std::printf("%s\n", profile.ToJson().c_str());
+  if (header && !WriteFile(header, profile.ToHeader(top))) {
+    std::fprintf(stderr, "could not write %s\n", header);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,521 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_REGISTRY_H
+#define TIC28X_REGISTRY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "instructions.h"
+
+namespace TIC28X {
+/**
+ * Immortal - storage for a singleton that is never destroyed, so it stays
+ * valid for analysis threads that are still running while the plugin unloads.
+ * Instruction singletons are also constructed at compile time.
+ */
+template <class T>
+union Immortal {
+  constexpr Immortal() : value() {}
+  constexpr ~Immortal() {}
+  T value;
+};
+
+template <class T>
+constinit inline Immortal<T> INSTANCE;
+
+// Static branch target helper of an instruction class, if it has one
+using TargetFunction = uint64_t (*)(uint32_t data, uint64_t addr);
+
+template <class T>
+constexpr TargetFunction TargetOf() {
+  if constexpr (requires { &T::GetTarget; }) {
+    return &T::GetTarget;
+  } else {
+    return nullptr;
+  }
+}
+
+/**
+ * InstructionRegistry - compile-time list of instruction classes.
+ *
+ * Every per-instruction table is generated from the static data each class
+ * already exposes, so all of them live in read-only data and are indexed by
+ * the same instruction id (the position of the class in the list). The order
+ * of the list is the decode priority: when two encodings overlap, the
+ * instruction listed first wins.
+ */
+template <class... Ts>
+struct InstructionRegistry {
+  static constexpr size_t COUNT = sizeof...(Ts);
+
+  static constexpr std::array<uint32_t, COUNT> OPCODES = {Ts::opcode...};
+  static constexpr std::array<uint32_t, COUNT> OPCODE_MASKS = {
+      Ts::opcode_mask...};
+  static constexpr std::array<uint8_t, COUNT> LENGTHS = {Ts::length...};
+  static constexpr std::array<ObjectMode, COUNT> OBJMODES = {Ts::objmode...};
+  static constexpr std::array<bool, COUNT> REPEATABLE = {Ts::repeatable...};
+  static constexpr std::array<const char*, COUNT> FULL_NAMES = {
+      Ts::full_name...};
+  static constexpr std::array<const char*, COUNT> OP_NAMES = {Ts::op_name...};
+  static constexpr std::array<BranchKind, COUNT> BRANCHES = {Ts::branch...};
+  // Whether Text depends only on the instruction word and address mode, so
+  // its output can be memoized (see TextCache). PC-relative instructions
+  // clear address_independent.
+  static constexpr std::array<bool, COUNT> ADDRESS_INDEPENDENT = {
+      Ts::address_independent...};
+  // Most tokens Text renders, for sizing the result once
+  static constexpr std::array<uint8_t, COUNT> MAX_TOKENS = {
+      MaxTextTokens(Ts::full_name, Ts::fields)...};
+  static constexpr std::array<TargetFunction, COUNT> TARGETS = {
+      TargetOf<Ts>()...};
+  static constexpr std::array<std::span<const Field>, COUNT> FIELDS = {
+      std::span<const Field>(Ts::fields)...};
+  static constexpr std::array<Instruction*, COUNT> INSTRUCTIONS = {
+      &INSTANCE<Ts>.value...};
+
+  // Instruction id of a class in the list, or COUNT if it is not listed
+  template <class T>
+  static constexpr uint16_t ID = [] {
+    constexpr std::array<bool, COUNT> matches = {std::is_same_v<T, Ts>...};
+    uint16_t id = 0;
+    while (id < COUNT && !matches[id]) {
+      id++;
+    }
+    return id;
+  }();
+};
+
+/* All CPU instructions, in decode priority order */
+using Registry = InstructionRegistry<
+    Aborti,
+    AbsAcc,
+    AbstcAcc,
+    AddAccConst16Shift,
+    AddAccLoc16ShiftT,
+    AddAccLoc16,
+    AddAccLoc16Shift1_15,
+    AddAccLoc16Shift16,
+    AddAccLoc16Shift0_15,
+    AddAxLoc16,
+    AddLoc16Ax,
+    AddLoc16Const16,
+    AddbAccConst8,
+    AddbAxConst8,
+    AddbSpConst7,
+    AddbXarnConst7,
+    AddclAccLoc32,
+    AddcuAccLoc16,
+    AddlAccLoc32,
+    AddlAccPShiftPm,
+    AddlLoc32Acc,
+    AdduAccLoc16,
+    AddulPLoc32,
+    AddulAccLoc32,
+    AdrkImm8,
+    AndAccConst16Shift0_15,
+    AndAccConst16Shift16,
+    AndAccLoc16,
+    AndAxLoc16Const16,
+    AndIerConst16,
+    AndIfrConst16,
+    AndLoc16Ax,
+    AndAxLoc16,
+    AndLoc16Const16,
+    AndbAxConst8,
+    Asp,
+    AsrAxShift,
+    AsrAxT,
+    Asr64AccPShift,
+    Asr64AccPT,
+    AsrlAccT,
+    BOff16Cond,
+    BanzOff16Arn,
+    BarOff16ArnArmEq,
+    BarOff16ArnArmNeq,
+    BfOff16Cond,
+    ClrcAmode,
+    ClrcM0M1Map,
+    ClrcObjmode,
+    ClrcOvc,
+    ClrcXf,
+    ClrcMode,
+    CmpAxLoc16,
+    CmpLoc16Const16,
+    Cmp64AccP,
+    CmpbAxConst8,
+    CmplAccLoc32,
+    CmplAccPShiftPm,
+    Cmpr0,
+    Cmpr1,
+    Cmpr2,
+    Cmpr3,
+    CsbAcc,
+    DecLoc16,
+    DmacAccPLoc32Xar7,
+    DmacAccPLoc32Xar7Postinc,
+    DmovLoc16,
+    Eallow,
+    Edis,
+    Estop0,
+    Estop1,
+    FfcXar7Const22,
+    FlipAx,
+    IackConst16,
+    Idle,
+    ImaclPLoc32Xar7,
+    ImaclPLoc32Xar7Postinc,
+    ImpyalPXtLoc32,
+    ImpylAccXtLoc32,
+    ImpylPXtLoc32,
+    ImpyslPXtLoc32,
+    ImpyxulPXtLoc32,
+    InLoc16Pa,
+    IncLoc16,
+    IntrIntx,
+    IntrNmi,
+    IntrEmuint,
+    Iret,
+    LbXar7,
+    LbConst22,
+    LcXar7,
+    LcConst22,
+    LcrConst22,
+    LcrXarn,
+    LoopnzLoc16Const16,
+    LoopzLoc16Const16,
+    Lpaddr,
+    Lret,
+    Lrete,
+    Lretr,
+    LslAccShift,
+    LslAccT,
+    LslAxShift,
+    LslAxT,
+    Lsl64AccPShift,
+    Lsl64AccPT,
+    LsllAccT,
+    LsrAxShift,
+    LsrAxT,
+    Lsr64AccPShift,
+    Lsr64AccPT,
+    LsrlAccT,
+    MacPLoc16Pma,
+    MacPLoc16Xar7,
+    MacPLoc16Xar7Postinc,
+    MaxAxLoc16,
+    MaxculPLoc32,
+    MaxlAccLoc32,
+    MinAxLoc16,
+    MinculPLoc32,
+    MinlAccLoc32,
+    MovMem16Loc16,
+    MovAccConst16Shift,
+    MovAccLoc16ShiftT,
+    MovAccLoc16Objmode1,
+    MovAccLoc16Objmode0,
+    MovAccLoc16Shift1_15Objmode1,
+    MovAccLoc16Shift1_15Objmode0,
+    MovAccLoc16Shift16,
+    MovAr6Loc16,
+    MovAr7Loc16,
+    MovAxLoc16,
+    MovDpConst10,
+    MovIerLoc16,
+    MovLoc16Const16,
+    MovLoc16Mem16,
+    MovLoc16_0,
+    MovLoc16AccShift1,
+    MovLoc16AccShift2_8Objmode1,
+    MovLoc16AccShift2_8Objmode0,
+    MovLoc16Arn,
+    MovLoc16Ax,
+    MovLoc16AxCond,
+    MovLoc16Ier,
+    MovLoc16Ovc,
+    MovLoc16P,
+    MovLoc16T,
+    MovOvcLoc16,
+    MovPhLoc16,
+    MovPlLoc16,
+    MovPmAx,
+    MovTLoc16,
+    MovTl0,
+    MovXarnPc,
+    MovaTLoc16,
+    MovadTLoc16,
+    MovbAccConst8,
+    MovbAr6Const8,
+    MovbAr7Const8,
+    MovbAxConst8,
+    MovbAxlsbLoc16,
+    MovbAxmsbLoc16,
+    MovbLoc16Const8Cond,
+    MovbLoc16Axlsb,
+    MovbLoc16Axmsb,
+    MovbXar0Const8,
+    MovbXar1Const8,
+    MovbXar2Const8,
+    MovbXar3Const8,
+    MovbXar4Const8,
+    MovbXar5Const8,
+    MovbXar6Const8,
+    MovbXar7Const8,
+    MovdlXtLoc32,
+    MovhLoc16AccShift1,
+    MovhLoc16AccShift2_8Objmode1,
+    MovhLoc16AccShift2_8Objmode0,
+    MovhLoc16P,
+    MovlAccLoc32,
+    MovlAccPShiftPm,
+    MovlLoc32Acc,
+    MovlLoc32AccCond,
+    MovlLoc32P,
+    MovlLoc32Xar0,
+    MovlLoc32Xar1,
+    MovlLoc32Xar2,
+    MovlLoc32Xar3,
+    MovlLoc32Xar4,
+    MovlLoc32Xar5,
+    MovlLoc32Xar6,
+    MovlLoc32Xar7,
+    MovlLoc32Xt,
+    MovlPAcc,
+    MovlPLoc32,
+    MovlXar0Loc32,
+    MovlXar1Loc32,
+    MovlXar2Loc32,
+    MovlXar3Loc32,
+    MovlXar4Loc32,
+    MovlXar5Loc32,
+    MovlXar6Loc32,
+    MovlXar7Loc32,
+    MovlXar0Const22,
+    MovlXar1Const22,
+    MovlXar2Const22,
+    MovlXar3Const22,
+    MovlXar4Const22,
+    MovlXar5Const22,
+    MovlXar6Const22,
+    MovlXar7Const22,
+    MovlXtLoc32,
+    MovpTLoc16,
+    MovsTLoc16,
+    MovuAccLoc16,
+    MovuLoc16Ovc,
+    MovuOvcLoc16,
+    MovwDpConst16,
+    MovxTlLoc16,
+    MovzAr0Loc16,
+    MovzAr1Loc16,
+    MovzAr2Loc16,
+    MovzAr3Loc16,
+    MovzAr4Loc16,
+    MovzAr5Loc16,
+    MovzAr6Loc16,
+    MovzAr7Loc16,
+    MovzDpConst10,
+    MpyAccLoc16Const16,
+    MpyAccTLoc16,
+    MpyPLoc16Const16,
+    MpyPTLoc16,
+    MpyaPLoc16Const16,
+    MpyaPTLoc16,
+    MpybAccTConst8,
+    MpybPTConst8,
+    MpysPTLoc16,
+    MpyuPTLoc16,
+    MpyuAccTLoc16,
+    MpyxuAccTLoc16,
+    MpyxuPTLoc16,
+    Nasp,
+    NegAcc,
+    NegAx,
+    Neg64AccP,
+    NegtcAcc,
+    NopIndArpn,
+    NormAccInd,
+    NormAccIndPostinc,
+    NormAccIndPostdec,
+    NormAccInd0Postinc,
+    NormAccInd0Postdec,
+    NormAccXarnPostinc,
+    NormAccXarnPostdec,
+    NotAcc,
+    NotAx,
+    OrAccLoc16,
+    OrAccConst16Shift0_15,
+    OrAccConst16Shift16,
+    OrAxLoc16,
+    OrIerConst16,
+    OrIfrConst16,
+    OrLoc16Const16,
+    OrLoc16Ax,
+    OrbAxConst8,
+    OutPaLoc16,
+    PopAr1Ar0,
+    PopAr3Ar2,
+    PopAr5Ar4,
+    PopAr1hAr0h,
+    PopDbgier,
+    PopDp,
+    PopDpSt1,
+    PopIfr,
+    PopLoc16,
+    PopP,
+    PopRpc,
+    PopSt0,
+    PopSt1,
+    PopTSt0,
+    PopXt,
+    PreadLoc16Xar7,
+    PushAr1Ar0,
+    PushAr3Ar2,
+    PushAr5Ar4,
+    PushAr1hAr0h,
+    PushDbgier,
+    PushDp,
+    PushDpSt1,
+    PushIfr,
+    PushLoc16,
+    PushP,
+    PushRpc,
+    PushSt0,
+    PushSt1,
+    PushTSt0,
+    PushXt,
+    PwriteXar7Loc16,
+    QmaclPLoc32Xar7,
+    QmaclPLoc32Xar7Postinc,
+    QmpyalPXtLoc32,
+    QmpylPXtLoc32,
+    QmpylAccXtLoc32,
+    QmpyslPXtLoc32,
+    QmpyulPXtLoc32,
+    QmpyxulPXtLoc32,
+    RolAcc,
+    RorAcc,
+    RptConst8,
+    RptLoc16,
+    SatAcc,
+    Sat64AccP,
+    SbOff8Cond,
+    SbbuAccLoc16,
+    SbfOff8Eq,
+    SbfOff8Neq,
+    SbfOff8Tc,
+    SbfOff8Ntc,
+    SbrkConst8,
+    SetcMode,
+    SetcM0M1Map,
+    SetcObjmode,
+    SetcXf,
+    SfrAccShift,
+    SfrAccT,
+    SpmShift,
+    SqraLoc16,
+    SqrsLoc16,
+    SubAccLoc16Objmode1,
+    SubAccLoc16Objmode0,
+    SubAccLoc16Shift1_15Objmode1,
+    SubAccLoc16Shift1_15Objmode0,
+    SubAccLoc16Shift16,
+    SubAccLoc16ShiftT,
+    SubAccConst16Shift,
+    SubAxLoc16,
+    SubLoc16Ax,
+    SubbAccConst8,
+    SubbSpConst7,
+    SubbXarnConst7,
+    SubblAccLoc32,
+    SubcuAccLoc16,
+    SubculAccLoc32,
+    SublAccLoc32,
+    SublLoc32Acc,
+    SubrLoc16Ax,
+    SubrlLoc32Acc,
+    SubuAccLoc16,
+    SubulAccLoc32,
+    SubulPLoc32,
+    TbitLoc16Bit,
+    TbitLoc16T,
+    TclrLoc16Bit,
+    TestAcc,
+    TrapVec,
+    TsetLoc16Bit,
+    UoutPaLoc16,
+    XbAl,
+    XbPmaArpn,
+    XbPmaCond,
+    XbanzPmaInd,
+    XbanzPmaIndPostinc,
+    XbanzPmaIndPostdec,
+    XbanzPmaInd0Postinc,
+    XbanzPmaInd0Postdec,
+    XbanzPmaIndArpn,
+    XbanzPmaIndPostincArpn,
+    XbanzPmaIndPostdecArpn,
+    XbanzPmaInd0PostincArpn,
+    XbanzPmaInd0PostdecArpn,
+    XcallAl,
+    XcallPmaArpn,
+    XcallPmaCond,
+    XmacPLoc16Pma,
+    XmacdPLoc16Pma,
+    XorAccLoc16,
+    XorAccConst16Shift0_15,
+    XorAccConst16Shift16,
+    XorAxLoc16,
+    XorLoc16Ax,
+    XorLoc16Const16,
+    XorbAxConst8,
+    XpreadLoc16Pma,
+    XpreadLoc16Al,
+    XpwriteAlLoc16,
+    XretcCond,
+    ZalrAccLoc16,
+    Zapa,
+
+    /* Extended Instruction Set */
+
+    // FPU Instructions
+    Absf32RahRbh,
+    Addf32Rah16fhiRbh,
+    Addf32RahRbhRch,
+    Addf32RdhRehRfhMov32Mem32Rah,
+    Addf32RdhRehRfhMov32RahMem32,
+    Cmpf32RahRbh,
+    Cmpf32Rah16fhi,
+    Cmpf32Rah0,
+    Einvf32RahRbh,
+    Eisqrtf32RahRbh,
+    F32toi16RahRbh,
+    F32toi16rRahRbh,
+    F32toi32RahRbh,
+    F32toui16RahRbh,
+    F32toui16rRahRbh,
+    F32toui32RahRbh,
+    Fracf32RahRbh,
+    I16tof32RahRbh,
+    I16tof32RahMem16,
+    I32tof32RahMem32,
+    I32tof32RahRbh,
+    Macf32R3hR2hRdhRehRfh,
+    Macf32R3hR2hRdhRehRfhMov32RahMem32,
+    Macf32R7hR3hMem32Xar7Postinc,
+    Macf32R7hR6hRdhRehRfh,
+    Macf32R7hR6hRdhRehRfhMov32RahMem32,
+    Maxf32RahRbh,
+    Maxf32Rah16fhi,
+    Maxf32RahRbhMov32RchRdh,
+    Minf32RahRbh,
+    Minf32Rah16fhi>;
+
+static_assert(Registry::COUNT < 0x8000, "instruction ids must fit in 15 bits");
+}  // namespace TIC28X
+
+#endif  // TIC28X_REGISTRY_H
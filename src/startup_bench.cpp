@@ -0,0 +1,89 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+/**
+ * startup_bench - measures what loading the plugin costs: heap allocations
+ * and time spent in CorePluginInit, then in the first instruction each
+ * architecture decodes.
+ *
+ * Allocations are counted by replacing the global operator new, which also
+ * catches allocations made inside the plugin library on ELF and Mach-O
+ * platforms. Registering architectures needs a Binary Ninja core, so run it
+ * with a headless core available.
+ *
+ * Usage: tic28x_startup_bench
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "architecture.h"
+#include "instructions.h"
+
+namespace {
+std::atomic<uint64_t> ALLOCATIONS = 0;
+}  // namespace
+
+void* operator new(const size_t size) {
+  ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+extern "C" bool CorePluginInit();
+
+namespace {
+// Runs step once, and reports how long it took and how much it allocated
+template <class Step>
+bool Measure(const char* name, const Step& step) {
+  const uint64_t before = ALLOCATIONS.load();
+  const auto start = std::chrono::steady_clock::now();
+  const bool ok = step();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const uint64_t allocations = ALLOCATIONS.load() - before;
+
+  std::printf("%-28s %8llu allocations %10.1f us%s\n", name,
+              static_cast<unsigned long long>(allocations),
+              std::chrono::duration<double, std::micro>(elapsed).count(),
+              ok ? "" : " (failed)");
+  return ok;
+}
+}  // namespace
+
+int main() {
+  if (!Measure("CorePluginInit", CorePluginInit)) {
+    return 1;
+  }
+
+  // LB 0x3f1234, valid in every mode
+  const uint32_t op = TIC28X::LbConst22::SetConst22(0x3F1234);
+  const uint8_t data[] = {
+      static_cast<uint8_t>(op >> 16 & 0xFF), static_cast<uint8_t>(op >> 24),
+      static_cast<uint8_t>(op & 0xFF), static_cast<uint8_t>(op >> 8 & 0xFF)};
+
+  bool ok = true;
+  for (const char* name : {"tic28x", "tic28x_c2xlp", "tic28x_c27x"}) {
+    const auto arch = BN::Architecture::GetByName(name);
+    if (!arch) {
+      std::printf("%s is not registered\n", name);
+      return 1;
+    }
+    for (const char* step : {"first", "second"}) {
+      char label[64];
+      std::snprintf(label, sizeof(label), "%s %s decode", name, step);
+      ok &= Measure(label, [&] {
+        BN::InstructionInfo info;
+        return arch->GetInstructionInfo(data, 0x100, sizeof(data), info);
+      });
+    }
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "sweep.h"
+
+#include <algorithm>
+#include <array>
+
+#include "bulk.h"
+#include "decoder.h"
+#include "registry.h"
+
+namespace TIC28X {
+/**
+ * Clear - removes all records but keeps the allocated storage.
+ */
+void DecodeRecords::Clear() {
+  addrs.clear();
+  ids.clear();
+  lengths.clear();
+  words.clear();
+  branches.clear();
+  targets.clear();
+}
+
+/**
+ * Append - adds a record to the end of every array.
+ */
+void DecodeRecords::Append(const uint64_t addr, const uint16_t id,
+                           const uint8_t length, const uint32_t word,
+                           const BranchKind branch, const uint64_t target) {
+  addrs.push_back(addr);
+  ids.push_back(id);
+  lengths.push_back(length);
+  words.push_back(word);
+  branches.push_back(branch);
+  targets.push_back(target);
+}
+
+/**
+ * Reserve - makes room for count records in every array.
+ *
+ * @param count - number of records
+ */
+void DecodeRecords::Reserve(const size_t count) {
+  addrs.reserve(count);
+  ids.reserve(count);
+  lengths.reserve(count);
+  words.reserve(count);
+  branches.reserve(count);
+  targets.reserve(count);
+}
+
+namespace {
+// Halfwords looked up per bulk step, small enough to keep on the stack
+constexpr size_t CHUNK = 1024;
+}  // namespace
+
+/**
+ * DecodeRange - linear sweep decode of a contiguous range of opcode data.
+ *
+ * Instructions are decoded back to back starting at data. The first-level
+ * table lookups and 32-bit words are produced a chunk at a time by the bulk
+ * kernels (see bulk.h), so the sweep itself only follows lengths and walks the
+ * occasional chain. Only the decode tables and the Registry's static data are
+ * used; no instruction objects are touched and no Binary Ninja structures are
+ * built. Records reuse the storage already held by records, so sweeping a
+ * large image in chunks with the same records does not allocate after the
+ * first chunk.
+ *
+ * @param data - pointer to opcode data
+ * @param len - length of data in bytes
+ * @param base - address of data[0]
+ * @param objmode - object mode to decode in
+ * @param records - cleared, then receives one record per instruction
+ * @return number of bytes consumed; less than len if the range ends in the
+ * middle of an instruction
+ */
+size_t DecodeRange(const uint8_t* data, const size_t len, const uint64_t base,
+                   const ObjectMode objmode, DecodeRecords& records) {
+  const auto& table = GetDecodeTable(objmode);
+  const auto& kernels = GetBulkKernels();
+  std::array<uint16_t, CHUNK> entries;
+  std::array<uint32_t, CHUNK + 1> words;
+
+  const size_t halfwords = len / Sizes::_2_BYTES;
+  records.Clear();
+  records.Reserve(halfwords);
+
+  size_t first = 0;  // first halfword of the current chunk
+  while (first < halfwords) {
+    // words[k] also needs halfword k + 1, which may be in the next chunk
+    const size_t count = std::min(CHUNK, halfwords - first);
+    kernels.lookup16(data + first * 2, count, table, entries.data());
+    kernels.swizzle_words(data + first * 2,
+                          std::min(count + 1, halfwords - first), words.data());
+
+    size_t k = 0;
+    while (k < count) {
+      const size_t offset = (first + k) * Sizes::_2_BYTES;
+      const uint64_t addr = base + offset;
+      const bool has_lsw = first + k + 1 < halfwords;
+
+      uint16_t id = entries[k];
+      if (id != DecodeTable::INVALID && id & DecodeTable::CHAIN) {
+        if (!has_lsw) {
+          return offset;  // the LSW is past the end of the range
+        }
+        id = table.Lookup32(id & ~DecodeTable::CHAIN, words[k]);
+      }
+
+      if (id == DecodeTable::INVALID) {
+        records.Append(addr, id, 0, words[k] >> 16, BRANCH_NONE, 0);
+        k++;
+        continue;
+      }
+
+      const size_t length = Registry::LENGTHS[id];
+      if (length == Sizes::_4_BYTES && !has_lsw) {
+        return offset;
+      }
+      const uint32_t word =
+          length == Sizes::_4_BYTES ? words[k] : words[k] >> 16;
+      const auto get_target = Registry::TARGETS[id];
+
+      records.Append(addr, id, length, word, Registry::BRANCHES[id],
+                     get_target ? get_target(word, addr) : 0);
+      k += length / Sizes::_2_BYTES;
+    }
+    first += k;
+  }
+  return first * Sizes::_2_BYTES;
+}
+}  // namespace TIC28X
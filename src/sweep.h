@@ -0,0 +1,40 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_SWEEP_H
+#define TIC28X_SWEEP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "architecture.h"
+
+namespace TIC28X {
+/**
+ * DecodeRecords - structure-of-arrays output of DecodeRange. Record i is
+ * described by element i of every array.
+ *
+ * Invalid halfwords are kept as records with id DecodeTable::INVALID and
+ * length 0; the sweep steps over them by one halfword.
+ */
+struct DecodeRecords {
+  std::vector<uint64_t> addrs;        // address of the instruction
+  std::vector<uint16_t> ids;          // instruction id (see Registry)
+  std::vector<uint8_t> lengths;       // instruction length in bytes
+  std::vector<uint32_t> words;        // opcode, as built by DataToOpcode
+  std::vector<BranchKind> branches;   // branches added by Info
+  std::vector<uint64_t> targets;      // branch target, or 0 if not static
+
+  [[nodiscard]] size_t Size() const { return ids.size(); }
+  void Append(uint64_t addr, uint16_t id, uint8_t length, uint32_t word,
+              BranchKind branch, uint64_t target);
+  void Clear();
+  void Reserve(size_t count);
+};
+
+size_t DecodeRange(const uint8_t* data, size_t len, uint64_t base,
+                   ObjectMode objmode, DecodeRecords& records);
+}  // namespace TIC28X
+
+#endif  // TIC28X_SWEEP_H
@@ -0,0 +1,104 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "sweep.h"
+
+#include <binaryninjaapi.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "decoder.h"
+#include "instructions.h"
+#include "registry.h"
+#include "test_util.h"
+
+constexpr uint64_t BASE = 0x3F0000;
+
+// Verify that a sweep over arbitrary data agrees with decoding one address at
+// a time through the architecture
+class TestDecodeRange : public ::testing::TestWithParam<TIC28X::ObjectMode> {};
+
+TEST_P(TestDecodeRange, MatchesDecoder) {
+  const TIC28X::ObjectMode objmode = GetParam();
+  const auto& table = TIC28X::GetDecodeTable(objmode);
+  const auto arch =
+      std::make_unique<TIC28X::TIC28XArchitecture>("tic28x-test", objmode);
+
+  const auto data = random_bytes(0x10000);
+
+  TIC28X::DecodeRecords records;
+  const size_t consumed =
+      TIC28X::DecodeRange(data.data(), data.size(), BASE, objmode, records);
+  ASSERT_GE(consumed + 2, data.size());
+
+  size_t offset = 0;
+  for (size_t r = 0; r < records.Size(); r++) {
+    const uint64_t addr = BASE + offset;
+    ASSERT_EQ(addr, records.addrs[r]);
+
+    const auto inst = TIC28X::DecodeInstruction(data.data() + offset, table);
+    if (!inst) {
+      EXPECT_EQ(TIC28X::DecodeTable::INVALID, records.ids[r]);
+      EXPECT_EQ(0, records.lengths[r]);
+      offset += 2;
+      continue;
+    }
+    ASSERT_EQ(inst, TIC28X::Registry::INSTRUCTIONS[records.ids[r]])
+        << std::hex << "addr 0x" << addr;
+    ASSERT_EQ(inst->GetLength(), records.lengths[r]);
+
+    const auto decoded = TIC28X::Decode(data.data() + offset, addr, table);
+    ASSERT_TRUE(decoded.has_value());
+    BN::InstructionInfo info;
+    ASSERT_TRUE(inst->Info(*decoded, addr, info, arch.get()));
+    EXPECT_EQ(records.branches[r] == TIC28X::BRANCH_NONE, info.branchCount == 0)
+        << inst->GetFullName();
+    if (TIC28X::Registry::TARGETS[records.ids[r]]) {
+      const auto end = info.branchTarget + info.branchCount;
+      EXPECT_NE(end, std::find(info.branchTarget, end, records.targets[r]))
+          << inst->GetFullName();
+    }
+    offset += records.lengths[r];
+  }
+  EXPECT_EQ(consumed, offset);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllObjmodes, TestDecodeRange,
+                         ::testing::ValuesIn(ALL_OBJMODES), objmode_name);
+
+// Verify branch records and that a range ending inside an instruction stops
+// before it
+TEST(TestDecodeRange, BranchesAndTruncation) {
+  const uint32_t lb = TIC28X::LbConst22::SetConst22(0x3F1234);
+  const uint16_t abs = TIC28X::AbsAcc::opcode;
+  const std::vector<uint8_t> data = {
+      abs & 0xFF,
+      abs >> 8,
+      static_cast<uint8_t>(lb >> 16 & 0xFF),
+      static_cast<uint8_t>(lb >> 24),
+      static_cast<uint8_t>(lb & 0xFF),
+      static_cast<uint8_t>(lb >> 8 & 0xFF),
+      static_cast<uint8_t>(lb >> 16 & 0xFF),
+      static_cast<uint8_t>(lb >> 24),
+  };
+
+  TIC28X::DecodeRecords records;
+  ASSERT_EQ(6, TIC28X::DecodeRange(data.data(), data.size(), BASE,
+                                   TIC28X::OBJMODE_1, records));
+  ASSERT_EQ(2, records.Size());
+
+  EXPECT_STREQ(TIC28X::AbsAcc::full_name,
+               TIC28X::Registry::FULL_NAMES[records.ids[0]]);
+  EXPECT_EQ(TIC28X::BRANCH_NONE, records.branches[0]);
+
+  EXPECT_STREQ(TIC28X::LbConst22::full_name,
+               TIC28X::Registry::FULL_NAMES[records.ids[1]]);
+  EXPECT_EQ(BASE + 2, records.addrs[1]);
+  EXPECT_EQ(4, records.lengths[1]);
+  EXPECT_EQ(lb, records.words[1]);
+  EXPECT_EQ(TIC28X::BRANCH_UNCONDITIONAL, records.branches[1]);
+  EXPECT_EQ(0x3F1234, records.targets[1]);
+}
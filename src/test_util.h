@@ -0,0 +1,43 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_TEST_UTIL_H
+#define TIC28X_TEST_UTIL_H
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "architecture.h"
+
+// Advance the LCG the tests use for reproducible pseudo-random samples
+inline uint32_t next_random(uint32_t& seed) {
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+// Reproducible pseudo-random opcode data
+inline std::vector<uint8_t> random_bytes(const size_t size) {
+  std::vector<uint8_t> data(size);
+  uint32_t seed = 0x28;
+  for (auto& byte : data) {
+    byte = next_random(seed) >> 24;
+  }
+  return data;
+}
+
+// Every object mode a decode table is built for, for parameterized tests
+inline constexpr std::array<TIC28X::ObjectMode, 3> ALL_OBJMODES = {
+    TIC28X::OBJMODE_0, TIC28X::OBJMODE_1, TIC28X::OBJMODE_ANY};
+
+// Test name suffix of an object mode parameter
+inline std::string objmode_name(
+    const testing::TestParamInfo<TIC28X::ObjectMode>& info) {
+  return "OBJMODE_" + std::to_string(info.param);
+}
+
+#endif  // TIC28X_TEST_UTIL_H
@@ -5,22 +5,66 @@
 
 #include <binaryninjaapi.h>
 
+#include <algorithm>
+#include <array>
 #include <format>
 
 #include "conditions.h"
 #include "flags.h"
 #include "instructions.h"
 #include "registers.h"
+#include "registry.h"
 #include "util.h"
 
 namespace TIC28X {
 // Temporary implementation until all instructions are implemented; TODO: remove
-bool Instruction::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Instruction::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        AddressMode amode) {
   return false;
 }
 
+/**
+ * SampleTextTokens - measures the most tokens an instruction class renders.
+ * Its encoding is rendered with every operand field swept through 0-0xFF and
+ * with pseudo-random operands, in both address modes. This is how
+ * src/text_tokens.h is generated (see tic28x_text_tokens).
+ *
+ * @param id - instruction id
+ * @return most tokens rendered, without the repeat prefix
+ */
+size_t SampleTextTokens(const uint16_t id) {
+  constexpr uint32_t SAMPLES = 0x140;
+  const uint32_t free_bits =
+      ~Registry::OPCODE_MASKS[id] &
+      (Registry::LENGTHS[id] == Sizes::_2_BYTES ? 0xFFFFu : 0xFFFFFFFFu);
+  uint32_t seed = 0x28;
+  size_t most = 0;
+  std::vector<BN::InstructionTextToken> tokens;
+  for (uint32_t sample = 0; sample < SAMPLES; sample++) {
+    seed = seed * 1664525u + 1013904223u;
+    uint32_t bits = seed;
+    if (sample <= 0xFF) {
+      bits = 0;
+      for (const auto& field : Registry::FIELDS[id]) {
+        bits |= field.Set(sample);
+      }
+    }
+    const DecodedInstruction decoded = {
+        .word = Registry::OPCODES[id] | (bits & free_bits),
+        .id = id,
+        .length = Registry::LENGTHS[id]};
+    for (const auto amode : {AMODE_0, AMODE_1}) {
+      size_t len = 0;
+      tokens.clear();
+      Registry::INSTRUCTIONS[id]->Text(decoded, 0x100, len, tokens, amode);
+      most = std::max(most, tokens.size());
+    }
+  }
+  return most;
+}
+
 /* Helper Functions */
 
 inline void OpText(const std::string& instr,
@@ -84,373 +128,232 @@ void RegText(const RegTextInfo rti,
   }
 }
 
+void ArpText(const uint8_t n, std::vector<BN::InstructionTextToken>& result) {
+  static constexpr std::array<const char*, 8> NAMES = {
+      "arp0", "arp1", "arp2", "arp3", "arp4", "arp5", "arp6", "arp7"};
+  result.emplace_back(TextToken, NAMES[n & 0x7]);
+}
+
 void ConstText(const ConstTextInfo& cti,
                std::vector<BN::InstructionTextToken>& result) {
   const auto mask = CreateLowerBitMask(cti.nbits);
+  HexBuffer hex;
 
   if (cti.is_signed) {
     int64_t value = cti.value & mask;
     if (cti.value & 1 << (cti.nbits - 1)) {  // check sign bit
       value |= ~mask;  // set upper bits to 1 for sign extension
     }
+    const std::string text(FormatHex(value, hex));
 
     if (cti.is_offset) {
       result.emplace_back(OperationToken, "[");
-      result.emplace_back(IntegerToken, std::format("0x{:x}", value), value);
+      result.emplace_back(IntegerToken, text, value);
       result.emplace_back(OperationToken, "]");
     } else {
       result.emplace_back(TextToken, "#");
-      result.emplace_back(IntegerToken, std::format("0x{:x}", value), value);
+      result.emplace_back(IntegerToken, text, value);
     }
   } else {
     const uint64_t value = cti.value & mask;
+    const std::string text(FormatHex(value, hex));
 
     if (cti.is_address) {
       result.emplace_back(TextToken, "@");
-      result.emplace_back(PossibleAddressToken, std::format("0x{:x}", value),
-                          value);
+      result.emplace_back(PossibleAddressToken, text, value);
     } else if (cti.is_offset) {
       result.emplace_back(OperationToken, "[");
-      result.emplace_back(IntegerToken, std::format("0x{:x}", value), value);
+      result.emplace_back(IntegerToken, text, value);
       result.emplace_back(OperationToken, "]");
     } else if (cti.is_memio) {
       result.emplace_back(OperationToken, "*");
       result.emplace_back(TextToken, "(");
-      result.emplace_back(PossibleAddressToken, std::format("0x{:x}", value),
-                          value);
+      result.emplace_back(PossibleAddressToken, text, value);
       result.emplace_back(TextToken, ")");
     } else {
       result.emplace_back(TextToken, "#");
-      result.emplace_back(IntegerToken, std::format("0x{:x}", value), value);
+      result.emplace_back(IntegerToken, text, value);
     }
   }
 }
 
-bool loc_text_helper(const LocTextInfo& lti,
-                     std::vector<BN::InstructionTextToken>& result) {
-  /* Direct Addressing Modes (DP) */
-  if ((lti.loc & 0xC0) == 0) {
-    if (lti.amode == AMODE_0) {  // AMODE0, code == 0 0 III III, @6bit
-      ConstText(ConstTextInfo{.value = lti.loc, .nbits = 6, .is_address = true},
-                result);
-    } else {  // AMODE1, code == 0 I III III, @@7bit
+/**
+ * LocText - renders a loc16/loc32 operand from its addressing mode (see
+ * addressing.h).
+ *
+ * @param mode - addressing mode descriptor
+ * @param result - tokens to append to
+ * @return false if the location code is invalid
+ */
+bool LocText(const LocMode& mode,
+             std::vector<BN::InstructionTextToken>& result) {
+  switch (mode.kind) {
+    case LOC_INVALID:
+      return false;
+
+    /* Direct Addressing Modes (DP) */
+    case LOC_DP_DIRECT_7BIT:  // @@7bit
       result.emplace_back(TextToken, "@");  // AMODE_1 requires extra @
-      ConstText(ConstTextInfo{.value = lti.loc, .nbits = 6, .is_address = true},
+      [[fallthrough]];
+    case LOC_DP_DIRECT:  // @6bit
+      ConstText(ConstTextInfo{.value = mode.imm,
+                              .nbits = mode.imm_bits,
+                              .is_address = true},
                 result);
-    }
-    return true;
-  }
+      break;
 
-  /* Stack Addressing Modes (SP) */
-  // AMODE0, code == 0 1 III III, *-SP[6bit]
-  if ((lti.loc & 0xC0) == 0x40 && lti.amode == AMODE_0) {
-    RegText(RegTextInfo{.regnum = Registers::SP, .indirect = true, .sub = true},
-            result);
-    ConstText(ConstTextInfo{.value = lti.loc, .nbits = 6, .is_offset = true},
+    /* Stack and C28x Indirect Addressing Modes (SP, XAR0 to XAR7) */
+    case LOC_SP_OFFSET:  // *-SP[6bit]
+      RegText(RegTextInfo{.regnum = mode.reg, .indirect = true, .sub = true},
               result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 111 101, *SP++
-  if (lti.loc == 0xBD) {
-    RegText(
-        RegTextInfo{.regnum = Registers::SP, .indirect = true, .postinc = true},
-        result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 111 110, *--SP
-  if (lti.loc == 0xBE) {
-    RegText(
-        RegTextInfo{.regnum = Registers::SP, .indirect = true, .predec = true},
-        result);
-    return true;
-  }
-
-  /* C28x Indirect Addressing Modes (XAR0 to XAR7) */
-  // AMODEx, code == 1 0 000 AAA, *XARn++
-  if ((lti.loc & 0xF8) == 0x80) {
-    const uint8_t regnum = Registers::XAR0 + (lti.loc & 0x7);
-    RegText(RegTextInfo{.regnum = regnum, .indirect = true, .postinc = true},
-            result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 001 AAA, *--XARn
-  if ((lti.loc & 0xF8) == 0x88) {
-    const uint8_t regnum = Registers::XAR0 + (lti.loc & 0x7);
-    RegText(RegTextInfo{.regnum = regnum, .indirect = true, .predec = true},
-            result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 010 AAA, *+XARn[AR0]
-  if ((lti.loc & 0xF8) == 0x90) {
-    const uint8_t regnum = Registers::XAR0 + (lti.loc & 0x7);
-    RegText(RegTextInfo{.regnum = regnum, .indirect = true, .add = true},
-            result);
-    RegText(RegTextInfo{.regnum = Registers::AR0, .is_offset = true}, result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 011 AAA, *+XARn[AR1]
-  if ((lti.loc & 0xF8) == 0x98) {
-    const uint8_t regnum = Registers::XAR0 + (lti.loc & 0x7);
-    RegText(RegTextInfo{.regnum = regnum, .indirect = true, .add = true},
-            result);
-    RegText(RegTextInfo{.regnum = Registers::AR1, .is_offset = true}, result);
-    return true;
-  }
-
-  // AMODE0, code == 1 1 III AAA, *+XARn[3bit]
-  if ((lti.loc & 0xC0) == 0xC0 && lti.amode == AMODE_0) {
-    const uint8_t regnum = Registers::XAR0 + (lti.loc & 0x7);
-    const uint8_t const3 = (lti.loc & 0x38) >> 3;
-    RegText(RegTextInfo{.regnum = regnum, .indirect = true, .add = true},
-            result);
-    ConstText(ConstTextInfo{.value = const3, .nbits = 3, .is_offset = true},
+      ConstText(ConstTextInfo{.value = mode.imm,
+                              .nbits = mode.imm_bits,
+                              .is_offset = true},
+                result);
+      break;
+    case LOC_SP_POSTINC:       // *SP++
+    case LOC_XARN_POSTINC:     // *XARn++
+    case LOC_ARP_BR0_POSTINC:  // *BR0++
+      RegText(
+          RegTextInfo{.regnum = mode.reg, .indirect = true, .postinc = true},
+          result);
+      break;
+    case LOC_SP_PREDEC:    // *--SP
+    case LOC_XARN_PREDEC:  // *--XARn
+      RegText(RegTextInfo{.regnum = mode.reg, .indirect = true, .predec = true},
               result);
-    return true;
-  }
-
-  /* C2xLP Indirect Addressing Modes (ARP, XAR0 to XAR7) */
-  // AMODEx, code == 1 0 111 000, *
-  if (lti.loc == 0xB8) {
-    result.emplace_back(OperationToken, "*");
-    return true;
-  }
-
-  // AMODEx, code == 1 0 111 001, *++
-  if (lti.loc == 0xB9) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(OperationToken, "++");
-    return true;
-  }
-
-  // AMODEx, code == 1 0 111 010, *--
-  if (lti.loc == 0xBA) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(OperationToken, "--");
-    return true;
-  }
-
-  // AMODEx, code == 1 0 111 011, *0++
-  if (lti.loc == 0xBB) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(IntegerToken, "0", 0);
-    result.emplace_back(OperationToken, "++");
-    return true;
-  }
-
-  // AMODEx, code == 1 0 111 100, *0--
-  if (lti.loc == 0xBC) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(TextToken, "0");
-    result.emplace_back(OperationToken, "--");
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 110, *BR0++
-  if (lti.loc == 0xAE) {
-    RegText(
-        RegTextInfo{
-            .regnum = Registers::BR0, .indirect = true, .postinc = true},
-        result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 111, *BR0--
-  if (lti.loc == 0xAF) {
-    RegText(
-        RegTextInfo{
-            .regnum = Registers::BR0, .indirect = true, .postdec = true},
-        result);
-
-    return true;
-  }
-
-  // AMODEx, code == 1 0 110 RRR, *,ARPn
-  if ((lti.loc & 0xF8) == 0xB0) {
-    result.emplace_back(OperationToken, "*");
-    OpsepText(result);
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
-
-  // AMODE1, code == 1 1 000 RRR, *++,ARPn
-  if ((lti.loc & 0xF8) == 0xC0 && lti.amode == AMODE_1) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(OperationToken, "++");
-    OpsepText(result);
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
-
-  // AMODE1, code == 1 1 001 RRR, *--,ARPn
-  if ((lti.loc & 0xF8) == 0xC8 && lti.amode == AMODE_1) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(OperationToken, "--");
-    OpsepText(result);
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
+      break;
+    case LOC_ARP_BR0_POSTDEC:  // *BR0--
+      RegText(
+          RegTextInfo{.regnum = mode.reg, .indirect = true, .postdec = true},
+          result);
+      break;
+    case LOC_XARN_INDEXED:  // *+XARn[AR0], *+XARn[AR1]
+      RegText(RegTextInfo{.regnum = mode.reg, .indirect = true, .add = true},
+              result);
+      RegText(RegTextInfo{.regnum = mode.index, .is_offset = true}, result);
+      break;
+    case LOC_XARN_OFFSET:  // *+XARn[3bit]
+      RegText(RegTextInfo{.regnum = mode.reg, .indirect = true, .add = true},
+              result);
+      ConstText(ConstTextInfo{.value = mode.imm,
+                              .nbits = mode.imm_bits,
+                              .is_offset = true},
+                result);
+      break;
 
-  // AMODE1, code == 1 1 010 RRR, *0++,ARPn
-  if ((lti.loc & 0xF8) == 0xD0 && lti.amode == AMODE_1) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(TextToken, "0");
-    result.emplace_back(OperationToken, "++");
-    OpsepText(result);
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
+    /* C2xLP Indirect Addressing Modes (ARP) */
+    case LOC_ARP:  // *
+      result.emplace_back(OperationToken, "*");
+      break;
+    case LOC_ARP_POSTINC:  // *++
+      result.emplace_back(OperationToken, "*");
+      result.emplace_back(OperationToken, "++");
+      break;
+    case LOC_ARP_POSTDEC:  // *--
+      result.emplace_back(OperationToken, "*");
+      result.emplace_back(OperationToken, "--");
+      break;
+    case LOC_ARP_AR0_POSTINC:  // *0++
+      result.emplace_back(OperationToken, "*");
+      // Plain *0++ renders its 0 as an integer, *0++,ARPn as text
+      if (mode.arp == LocMode::NO_ARP) {
+        result.emplace_back(IntegerToken, "0", 0);
+      } else {
+        result.emplace_back(TextToken, "0");
+      }
+      result.emplace_back(OperationToken, "++");
+      break;
+    case LOC_ARP_AR0_POSTDEC:  // *0--
+      result.emplace_back(OperationToken, "*");
+      result.emplace_back(TextToken, "0");
+      result.emplace_back(OperationToken, "--");
+      break;
 
-  // AMODE1, code == 1 1 011 RRR, *0--,ARPn
-  if ((lti.loc & 0xF8) == 0xD8 && lti.amode == AMODE_1) {
-    result.emplace_back(OperationToken, "*");
-    result.emplace_back(TextToken, "0");
-    result.emplace_back(OperationToken, "--");
-    OpsepText(result);
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
-
-  // AMODE1, code == 1 1 100 RRR, *BR0++,ARPn
-  if ((lti.loc & 0xF8) == 0xE0 && lti.amode == AMODE_1) {
-    RegText(
-        RegTextInfo{
-            .regnum = Registers::BR0, .indirect = true, .postinc = true},
-        result);
-    OpsepText(result);
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
-
-  // AMODE1, code == 1 1 101 RRR, *BR0--,ARPn
-  if ((lti.loc & 0xF8) == 0xE8 && lti.amode == AMODE_1) {
-    RegText(
-        RegTextInfo{
-            .regnum = Registers::BR0, .indirect = true, .postdec = true},
-        result);
-    result.emplace_back(OperandSeparatorToken, ",");
-    result.emplace_back(TextToken, std::format("arp{}", lti.loc & 0x7));
-    return true;
-  }
-
-  /* Circular Indirect Addressing Modes (XAR6, XAR1) */
-  // AMODEx, code == 1 0 111 111
-  if (lti.loc == 0xBF) {
-    if (lti.amode == AMODE_0) {  // *AR6%++
-      RegText(RegTextInfo{.regnum = Registers::AR6,
+    /* Circular Indirect Addressing Modes (XAR6, XAR1) */
+    case LOC_CIRCULAR:  // *AR6%++
+      RegText(RegTextInfo{.regnum = mode.reg,
                           .indirect = true,
                           .postinc = true,
                           .circular = true},
               result);
-      return true;
-    } else {  // *+XAR6[AR1%++]
-      RegText(
-          RegTextInfo{.regnum = Registers::AR6, .indirect = true, .add = true},
-          result);
-      RegText(RegTextInfo{.regnum = Registers::AR1,
+      break;
+    case LOC_CIRCULAR_INDEXED:  // *+XAR6[AR1%++]
+      RegText(RegTextInfo{.regnum = mode.reg, .indirect = true, .add = true},
+              result);
+      RegText(RegTextInfo{.regnum = mode.index,
                           .postinc = true,
                           .circular = true,
                           .is_offset = true},
               result);
-      return true;
-    }
-  }
-  return false;
-}
-
-bool Loc16Text(const LocTextInfo& lti,
-               std::vector<BN::InstructionTextToken>& result) {
-  // Try generic addressing mode text first. If we don't find a match try
-  // 16-bit
-  if (loc_text_helper(lti, result)) {
-    return true;
-  }
-
-  /* 16-bit Register Addressing Modes (AR0 to AR7, AH, AL, PH, PL, TH, SP) */
-  // AMODEx, code == 1 0 100 AAA, @ARn
-  if ((lti.loc & 0xF8) == 0xA0) {
-    const uint8_t regnum = Registers::AR0 + (lti.loc & 0x7);
-    RegText(RegTextInfo{.regnum = regnum, .direct = true}, result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 000, @AH
-  if (lti.loc == 0xA8) {
-    RegText(RegTextInfo{.regnum = Registers::AH, .direct = true}, result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 001, @AL
-  if (lti.loc == 0xA9) {
-    RegText(RegTextInfo{.regnum = Registers::AL, .direct = true}, result);
-    return true;
-  }
+      break;
 
-  // AMODEx, code == 1 0 101 010, @PH
-  if (lti.loc == 0xAA) {
-    RegText(RegTextInfo{.regnum = Registers::PH, .direct = true}, result);
-    return true;
+    /* Register Addressing Modes */
+    case LOC_REGISTER:  // @reg
+      RegText(RegTextInfo{.regnum = mode.reg, .direct = true}, result);
+      break;
   }
 
-  // AMODEx, code == 1 0 101 011, @PL
-  if (lti.loc == 0xAB) {
-    RegText(RegTextInfo{.regnum = Registers::PL, .direct = true}, result);
-    return true;
+  // AMODE1 C2xLP forms also select the next ARP, e.g. *++,ARPn
+  if (mode.arp != LocMode::NO_ARP) {
+    if (mode.kind == LOC_ARP_BR0_POSTDEC) {  // *BR0--,ARPn has no space
+      result.emplace_back(OperandSeparatorToken, ",");
+    } else {
+      OpsepText(result);
+    }
+    ArpText(mode.arp, result);
   }
+  return true;
+}
 
-  // AMODEx, code == 1 0 101 100, @TH
-  if (lti.loc == 0xAC) {
-    RegText(RegTextInfo{.regnum = Registers::TH, .direct = true}, result);
-    return true;
-  }
+namespace {
+using LocTokenTable =
+    std::array<std::vector<BN::InstructionTextToken>, LOC_MODES.size()>;
 
-  // AMODEx, code == 1 0 101 101, @SP
-  if (lti.loc == 0xAD) {
-    RegText(RegTextInfo{.regnum = Registers::SP, .direct = true}, result);
-    return true;
-  }
+/**
+ * GetLocTokens - the tokens LocText renders for every location code, indexed
+ * like LOC_MODES. Every part of a location operand, offsets included, comes
+ * from the code itself, so each sequence is rendered once, on first use.
+ *
+ * @return rendered tokens of every location code
+ */
+const LocTokenTable& GetLocTokens() {
+  // Never destroyed, like the instruction singletons, so the table outlives
+  // analysis threads that are still running while the plugin unloads
+  static const LocTokenTable* tokens = [] {
+    const auto table = new LocTokenTable();
+    for (size_t i = 0; i < LOC_MODES.size(); i++) {
+      LocText(LOC_MODES[i], (*table)[i]);
+    }
+    return table;
+  }();
+  return *tokens;
+}
+
+/**
+ * AppendLocTokens - appends a copy of the pre-rendered tokens of a location
+ * code.
+ *
+ * @param index - index into LOC_MODES
+ * @param result - tokens to append to
+ * @return false if the location code is invalid
+ */
+bool AppendLocTokens(const size_t index,
+                     std::vector<BN::InstructionTextToken>& result) {
+  const auto& tokens = GetLocTokens()[index];
+  result.insert(result.end(), tokens.begin(), tokens.end());
+  return LOC_MODES[index].kind != LOC_INVALID;
+}
+}  // namespace
 
-  return false;
+bool Loc16Text(const LocTextInfo& lti,
+               std::vector<BN::InstructionTextToken>& result) {
+  return AppendLocTokens(Addressing::Index(lti.loc, lti.amode, false), result);
 }
 
 bool Loc32Text(const LocTextInfo& lti,
                std::vector<BN::InstructionTextToken>& result) {
-  // Try generic addressing mode text first. If we don't find a match try 32-bit
-  if (loc_text_helper(lti, result)) {
-    return true;
-  }
-
-  /* 32-bit Register Addressing Modes (XAR0 to XAR7, ACC, P, XT) */
-  // AMODEx, code == 1 0 100 AAA, @XARn
-  if ((lti.loc & 0xF8) == 0xA0) {
-    const uint8_t regnum = Registers::XAR0 + (lti.loc & 0x7);
-    RegText(RegTextInfo{.regnum = regnum, .direct = true}, result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 001, @ACC
-  if (lti.loc == 0xA9) {
-    RegText(RegTextInfo{.regnum = Registers::ACC, .direct = true}, result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 011, @P
-  if (lti.loc == 0xAB) {
-    RegText(RegTextInfo{.regnum = Registers::P, .direct = true}, result);
-    return true;
-  }
-
-  // AMODEx, code == 1 0 101 100, @XT
-  if (lti.loc == 0xAC) {
-    RegText(RegTextInfo{.regnum = Registers::XT, .direct = true}, result);
-    return true;
-  }
-
-  return false;
+  return AppendLocTokens(Addressing::Index(lti.loc, lti.amode, true), result);
 }
 
 void CondText(const uint8_t cond,
@@ -617,7 +520,7 @@ bool TextOpArnLoc16(const char* op_name, const uint8_t n, const uint8_t loc16,
 
 /* Instruction Text Implementations */
 
-bool Aborti::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Aborti::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -627,7 +530,7 @@ bool Aborti::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AbsAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AbsAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -639,8 +542,8 @@ bool AbsAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AbstcAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool AbstcAcc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -651,10 +554,11 @@ bool AbstcAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAccConst16Shift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAccConst16Shift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -670,10 +574,11 @@ bool AddAccConst16Shift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAccLoc16ShiftT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAccLoc16ShiftT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -690,10 +595,11 @@ bool AddAccLoc16ShiftT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -708,10 +614,11 @@ bool AddAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAccLoc16Shift1_15::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAccLoc16Shift1_15::Text(const DecodedInstruction& decoded,
+                                uint64_t addr, size_t& len,
                                 std::vector<BN::InstructionTextToken>& result,
                                 const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -729,10 +636,11 @@ bool AddAccLoc16Shift1_15::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAccLoc16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAccLoc16Shift16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -749,10 +657,11 @@ bool AddAccLoc16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAccLoc16Shift0_15::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAccLoc16Shift0_15::Text(const DecodedInstruction& decoded,
+                                uint64_t addr, size_t& len,
                                 std::vector<BN::InstructionTextToken>& result,
                                 const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -770,10 +679,11 @@ bool AddAccLoc16Shift0_15::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -790,10 +700,11 @@ bool AddAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -810,10 +721,11 @@ bool AddLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -830,10 +742,11 @@ bool AddLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddbAccConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddbAccConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -846,10 +759,11 @@ bool AddbAccConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddbAxConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
@@ -864,10 +778,11 @@ bool AddbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddbSpConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddbSpConst7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const7 = GetConst7(dataOp);
   len = GetLength();
 
@@ -880,10 +795,11 @@ bool AddbSpConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddbXarnConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddbXarnConst7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const7 = GetConst7(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -898,10 +814,11 @@ bool AddbXarnConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddclAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddclAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -916,10 +833,11 @@ bool AddclAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddcuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddcuAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -934,10 +852,11 @@ bool AddcuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddlAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -952,7 +871,8 @@ bool AddlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddlAccPShiftPm::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddlAccPShiftPm::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
   len = GetLength();
@@ -968,10 +888,11 @@ bool AddlAccPShiftPm::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddlLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddlLoc32Acc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -986,10 +907,11 @@ bool AddlLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AdduAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AdduAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -1004,10 +926,11 @@ bool AdduAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddulPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddulPLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1022,10 +945,11 @@ bool AddulPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AddulAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AddulAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1040,10 +964,10 @@ bool AddulAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AdrkImm8::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool AdrkImm8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto imm8 = GetImm8(dataOp);
   len = GetLength();
 
@@ -1054,11 +978,11 @@ bool AdrkImm8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndAccConst16Shift0_15::Text(const uint8_t* data, uint64_t addr,
-                                  size_t& len,
+bool AndAccConst16Shift0_15::Text(const DecodedInstruction& decoded,
+                                  uint64_t addr, size_t& len,
                                   std::vector<BN::InstructionTextToken>& result,
                                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -1074,10 +998,11 @@ bool AndAccConst16Shift0_15::Text(const uint8_t* data, uint64_t addr,
   return true;
 }
 
-bool AndAccConst16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndAccConst16Shift16::Text(const DecodedInstruction& decoded,
+                                uint64_t addr, size_t& len,
                                 std::vector<BN::InstructionTextToken>& result,
                                 const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -1092,10 +1017,11 @@ bool AndAccConst16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -1110,10 +1036,11 @@ bool AndAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndAxLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndAxLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   const auto const16 = GetConst16(dataOp);
@@ -1133,10 +1060,11 @@ bool AndAxLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndIerConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndIerConst16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -1149,10 +1077,11 @@ bool AndIerConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndIfrConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndIfrConst16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -1165,10 +1094,11 @@ bool AndIfrConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -1185,10 +1115,11 @@ bool AndLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -1205,10 +1136,11 @@ bool AndAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -1224,10 +1156,11 @@ bool AndLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AndbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AndbAxConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
@@ -1242,7 +1175,7 @@ bool AndbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Asp::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Asp::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result,
                const AddressMode amode) {
   len = GetLength();
@@ -1252,10 +1185,11 @@ bool Asp::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AsrAxShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AsrAxShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -1270,10 +1204,10 @@ bool AsrAxShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AsrAxT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool AsrAxT::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -1287,10 +1221,11 @@ bool AsrAxT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Asr64AccPShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Asr64AccPShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   len = GetLength();
 
@@ -1305,7 +1240,8 @@ bool Asr64AccPShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Asr64AccPT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Asr64AccPT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -1321,8 +1257,8 @@ bool Asr64AccPT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool AsrlAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool AsrlAccT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -1335,10 +1271,11 @@ bool AsrlAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool BOff16Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool BOff16Cond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off16 = GetOff16(dataOp);
   const auto cond = GetCond(dataOp);
   len = GetLength();
@@ -1352,10 +1289,11 @@ bool BOff16Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool BanzOff16Arn::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool BanzOff16Arn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off16 = GetOff16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -1371,10 +1309,11 @@ bool BanzOff16Arn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool BarOff16ArnArmEq::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool BarOff16ArnArmEq::Text(const DecodedInstruction& decoded, uint64_t addr,
+                            size_t& len,
                             std::vector<BN::InstructionTextToken>& result,
                             const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off16 = GetOff16(dataOp);
   const auto n = GetRegN(dataOp);
   const auto m = GetRegM(dataOp);
@@ -1395,10 +1334,11 @@ bool BarOff16ArnArmEq::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool BarOff16ArnArmNeq::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool BarOff16ArnArmNeq::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off16 = GetOff16(dataOp);
   const auto n = GetRegN(dataOp);
   const auto m = GetRegM(dataOp);
@@ -1419,10 +1359,11 @@ bool BarOff16ArnArmNeq::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool BfOff16Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool BfOff16Cond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off16 = GetOff16(dataOp);
   const auto cond = GetCond(dataOp);
   len = GetLength();
@@ -1436,8 +1377,8 @@ bool BfOff16Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrcAmode::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool ClrcAmode::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -1446,7 +1387,8 @@ bool ClrcAmode::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrcM0M1Map::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ClrcM0M1Map::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
   len = GetLength();
@@ -1456,7 +1398,8 @@ bool ClrcM0M1Map::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrcObjmode::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ClrcObjmode::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
   len = GetLength();
@@ -1466,8 +1409,8 @@ bool ClrcObjmode::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrcOvc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool ClrcOvc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -1476,7 +1419,7 @@ bool ClrcOvc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrcXf::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ClrcXf::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -1486,10 +1429,10 @@ bool ClrcXf::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ClrcMode::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool ClrcMode::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto mode = GetMode(dataOp);
 
   if (mode == 0) {
@@ -1503,10 +1446,11 @@ bool ClrcMode::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CmpAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool CmpAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -1523,10 +1467,11 @@ bool CmpAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CmpLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool CmpLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -1543,8 +1488,8 @@ bool CmpLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Cmp64AccP::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool Cmp64AccP::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -1557,10 +1502,11 @@ bool Cmp64AccP::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CmpbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool CmpbAxConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
@@ -1575,10 +1521,11 @@ bool CmpbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CmplAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool CmplAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1593,7 +1540,8 @@ bool CmplAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CmplAccPShiftPm::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool CmplAccPShiftPm::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
   len = GetLength();
@@ -1609,7 +1557,7 @@ bool CmplAccPShiftPm::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Cmpr0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Cmpr0::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -1619,7 +1567,7 @@ bool Cmpr0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Cmpr1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Cmpr1::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -1629,7 +1577,7 @@ bool Cmpr1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Cmpr2::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Cmpr2::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -1639,7 +1587,7 @@ bool Cmpr2::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Cmpr3::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Cmpr3::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -1649,7 +1597,7 @@ bool Cmpr3::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool CsbAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool CsbAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -1661,10 +1609,10 @@ bool CsbAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool DecLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool DecLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -1677,10 +1625,11 @@ bool DecLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool DmacAccPLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool DmacAccPLoc32Xar7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1700,9 +1649,9 @@ bool DmacAccPLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
 }
 
 bool DmacAccPLoc32Xar7Postinc::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1723,10 +1672,10 @@ bool DmacAccPLoc32Xar7Postinc::Text(
   return true;
 }
 
-bool DmovLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool DmovLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -1739,7 +1688,7 @@ bool DmovLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Eallow::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Eallow::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -1749,7 +1698,7 @@ bool Eallow::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Edis::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Edis::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -1759,7 +1708,7 @@ bool Edis::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Estop0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Estop0::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -1769,7 +1718,7 @@ bool Estop0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Estop1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Estop1::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -1779,10 +1728,11 @@ bool Estop1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool FfcXar7Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool FfcXar7Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -1796,10 +1746,10 @@ bool FfcXar7Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool FlipAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool FlipAx::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -1811,10 +1761,11 @@ bool FlipAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool IackConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool IackConst16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -1825,7 +1776,7 @@ bool IackConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Idle::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Idle::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -1835,10 +1786,11 @@ bool Idle::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ImaclPLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ImaclPLoc32Xar7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1855,11 +1807,11 @@ bool ImaclPLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ImaclPLoc32Xar7Postinc::Text(const uint8_t* data, uint64_t addr,
-                                  size_t& len,
+bool ImaclPLoc32Xar7Postinc::Text(const DecodedInstruction& decoded,
+                                  uint64_t addr, size_t& len,
                                   std::vector<BN::InstructionTextToken>& result,
                                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1878,10 +1830,11 @@ bool ImaclPLoc32Xar7Postinc::Text(const uint8_t* data, uint64_t addr,
   return true;
 }
 
-bool ImpyalPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ImpyalPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1898,10 +1851,11 @@ bool ImpyalPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ImpylAccXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ImpylAccXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1918,10 +1872,11 @@ bool ImpylAccXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ImpylPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ImpylPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1938,10 +1893,11 @@ bool ImpylPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ImpyslPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ImpyslPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1958,10 +1914,11 @@ bool ImpyslPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ImpyxulPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ImpyxulPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -1978,10 +1935,10 @@ bool ImpyxulPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool InLoc16Pa::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool InLoc16Pa::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -1998,10 +1955,10 @@ bool InLoc16Pa::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool IncLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool IncLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2014,10 +1971,10 @@ bool IncLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool IntrIntx::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool IntrIntx::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetIntrX(dataOp);
   len = GetLength();
 
@@ -2034,8 +1991,8 @@ bool IntrIntx::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool IntrNmi::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool IntrNmi::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -2044,7 +2001,8 @@ bool IntrNmi::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool IntrEmuint::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool IntrEmuint::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -2054,7 +2012,7 @@ bool IntrEmuint::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Iret::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Iret::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -2064,7 +2022,7 @@ bool Iret::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LbXar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LbXar7::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -2076,10 +2034,10 @@ bool LbXar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LbConst22::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool LbConst22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -2091,7 +2049,7 @@ bool LbConst22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LcXar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LcXar7::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -2103,10 +2061,10 @@ bool LcXar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LcConst22::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool LcConst22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -2118,10 +2076,11 @@ bool LcConst22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LcrConst22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LcrConst22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -2133,10 +2092,10 @@ bool LcrConst22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LcrXarn::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool LcrXarn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto n = GetRegN(dataOp);
   len = GetLength();
 
@@ -2149,10 +2108,11 @@ bool LcrXarn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LoopnzLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LoopnzLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -2168,10 +2128,11 @@ bool LoopnzLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LoopzLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LoopzLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -2187,7 +2148,7 @@ bool LoopzLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lpaddr::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lpaddr::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -2197,7 +2158,7 @@ bool Lpaddr::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lret::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lret::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -2207,7 +2168,7 @@ bool Lret::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lrete::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lrete::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -2217,7 +2178,7 @@ bool Lrete::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lretr::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lretr::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -2227,10 +2188,11 @@ bool Lretr::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LslAccShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LslAccShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   len = GetLength();
 
@@ -2243,8 +2205,8 @@ bool LslAccShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LslAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool LslAccT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -2257,10 +2219,11 @@ bool LslAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LslAxShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LslAxShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -2275,10 +2238,10 @@ bool LslAxShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LslAxT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LslAxT::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -2292,10 +2255,11 @@ bool LslAxT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lsl64AccPShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lsl64AccPShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   len = GetLength();
 
@@ -2310,7 +2274,8 @@ bool Lsl64AccPShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lsl64AccPT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lsl64AccPT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -2326,8 +2291,8 @@ bool Lsl64AccPT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LsllAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool LsllAccT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -2340,10 +2305,11 @@ bool LsllAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LsrAxShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LsrAxShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -2358,10 +2324,10 @@ bool LsrAxShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LsrAxT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool LsrAxT::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -2375,10 +2341,11 @@ bool LsrAxT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lsr64AccPShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lsr64AccPShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   len = GetLength();
 
@@ -2393,7 +2360,8 @@ bool Lsr64AccPShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Lsr64AccPT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Lsr64AccPT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -2409,8 +2377,8 @@ bool Lsr64AccPT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool LsrlAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool LsrlAccT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -2423,10 +2391,11 @@ bool LsrlAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MacPLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MacPLoc16Pma::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -2447,10 +2416,11 @@ bool MacPLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MacPLoc16Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MacPLoc16Xar7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2467,10 +2437,11 @@ bool MacPLoc16Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MacPLoc16Xar7Postinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MacPLoc16Xar7Postinc::Text(const DecodedInstruction& decoded,
+                                uint64_t addr, size_t& len,
                                 std::vector<BN::InstructionTextToken>& result,
                                 const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2489,10 +2460,11 @@ bool MacPLoc16Xar7Postinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MaxAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MaxAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -2509,10 +2481,11 @@ bool MaxAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MaxculPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MaxculPLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -2527,10 +2500,11 @@ bool MaxculPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MaxlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MaxlAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -2545,10 +2519,11 @@ bool MaxlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MinAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MinAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -2565,10 +2540,11 @@ bool MinAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MinculPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MinculPLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -2583,10 +2559,11 @@ bool MinculPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MinlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MinlAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -2601,10 +2578,11 @@ bool MinlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovMem16Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovMem16Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -2621,10 +2599,11 @@ bool MovMem16Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAccConst16Shift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAccConst16Shift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -2640,10 +2619,11 @@ bool MovAccConst16Shift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAccLoc16ShiftT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAccLoc16ShiftT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2660,10 +2640,11 @@ bool MovAccLoc16ShiftT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAccLoc16Objmode1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAccLoc16Objmode1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2678,10 +2659,11 @@ bool MovAccLoc16Objmode1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAccLoc16Objmode0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAccLoc16Objmode0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2697,9 +2679,9 @@ bool MovAccLoc16Objmode0::Text(const uint8_t* data, uint64_t addr, size_t& len,
 }
 
 bool MovAccLoc16Shift1_15Objmode1::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -2718,9 +2700,9 @@ bool MovAccLoc16Shift1_15Objmode1::Text(
 }
 
 bool MovAccLoc16Shift1_15Objmode0::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -2738,10 +2720,11 @@ bool MovAccLoc16Shift1_15Objmode0::Text(
   return true;
 }
 
-bool MovAccLoc16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAccLoc16Shift16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2758,10 +2741,11 @@ bool MovAccLoc16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAr6Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAr6Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2776,10 +2760,11 @@ bool MovAr6Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAr7Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAr7Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2794,10 +2779,11 @@ bool MovAr7Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -2814,10 +2800,11 @@ bool MovAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovDpConst10::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovDpConst10::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const10 = GetConst10(dataOp);
   len = GetLength();
 
@@ -2830,10 +2817,11 @@ bool MovDpConst10::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovIerLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovIerLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2848,10 +2836,11 @@ bool MovIerLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -2867,10 +2856,11 @@ bool MovLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16Mem16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16Mem16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -2887,10 +2877,11 @@ bool MovLoc16Mem16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16_0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16_0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2905,10 +2896,11 @@ bool MovLoc16_0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16AccShift1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16AccShift1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -2926,9 +2918,9 @@ bool MovLoc16AccShift1::Text(const uint8_t* data, uint64_t addr, size_t& len,
 }
 
 bool MovLoc16AccShift2_8Objmode1::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -2947,9 +2939,9 @@ bool MovLoc16AccShift2_8Objmode1::Text(
 }
 
 bool MovLoc16AccShift2_8Objmode0::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -2967,10 +2959,11 @@ bool MovLoc16AccShift2_8Objmode0::Text(
   return true;
 }
 
-bool MovLoc16Arn::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16Arn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -2987,10 +2980,11 @@ bool MovLoc16Arn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -3007,10 +3001,11 @@ bool MovLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16AxCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16AxCond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   const auto cond = GetCond(dataOp);
@@ -3029,10 +3024,11 @@ bool MovLoc16AxCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16Ier::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16Ier::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3047,10 +3043,11 @@ bool MovLoc16Ier::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16Ovc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovLoc16Ovc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3065,10 +3062,10 @@ bool MovLoc16Ovc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16P::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool MovLoc16P::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3083,10 +3080,10 @@ bool MovLoc16P::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovLoc16T::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool MovLoc16T::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3101,10 +3098,11 @@ bool MovLoc16T::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovOvcLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovOvcLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3119,10 +3117,11 @@ bool MovOvcLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovPhLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovPhLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3137,10 +3136,11 @@ bool MovPhLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovPlLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovPlLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3155,10 +3155,10 @@ bool MovPlLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovPmAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool MovPmAx::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -3172,10 +3172,10 @@ bool MovPmAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool MovTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3190,7 +3190,7 @@ bool MovTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovTl0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovTl0::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -3204,10 +3204,10 @@ bool MovTl0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovXarnPc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool MovXarnPc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto n = GetRegN(dataOp);
   len = GetLength();
 
@@ -3221,10 +3221,11 @@ bool MovXarnPc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovaTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovaTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3239,10 +3240,11 @@ bool MovaTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovadTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovadTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3257,10 +3259,11 @@ bool MovadTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbAccConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbAccConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3273,10 +3276,11 @@ bool MovbAccConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbAr6Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbAr6Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3289,10 +3293,11 @@ bool MovbAr6Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbAr7Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbAr7Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3305,10 +3310,11 @@ bool MovbAr7Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbAxConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
@@ -3323,10 +3329,11 @@ bool MovbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbAxlsbLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbAxlsbLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -3344,10 +3351,11 @@ bool MovbAxlsbLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbAxmsbLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbAxmsbLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -3365,10 +3373,11 @@ bool MovbAxmsbLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbLoc16Const8Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbLoc16Const8Cond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const8 = GetConst8(dataOp);
   const auto cond = GetCond(dataOp);
@@ -3387,10 +3396,11 @@ bool MovbLoc16Const8Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbLoc16Axlsb::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbLoc16Axlsb::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -3408,10 +3418,11 @@ bool MovbLoc16Axlsb::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbLoc16Axmsb::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbLoc16Axmsb::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -3429,10 +3440,11 @@ bool MovbLoc16Axmsb::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar0Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar0Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3441,10 +3453,11 @@ bool MovbXar0Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar1Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar1Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3453,10 +3466,11 @@ bool MovbXar1Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar2Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar2Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3465,10 +3479,11 @@ bool MovbXar2Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar3Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar3Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3477,10 +3492,11 @@ bool MovbXar3Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar4Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar4Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3489,10 +3505,11 @@ bool MovbXar4Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar5Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar5Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3501,10 +3518,11 @@ bool MovbXar5Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar6Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar6Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3513,10 +3531,11 @@ bool MovbXar6Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovbXar7Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovbXar7Const8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -3525,10 +3544,11 @@ bool MovbXar7Const8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovdlXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovdlXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -3543,10 +3563,11 @@ bool MovdlXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovhLoc16AccShift1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovhLoc16AccShift1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3564,9 +3585,9 @@ bool MovhLoc16AccShift1::Text(const uint8_t* data, uint64_t addr, size_t& len,
 }
 
 bool MovhLoc16AccShift2_8Objmode1::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -3585,9 +3606,9 @@ bool MovhLoc16AccShift2_8Objmode1::Text(
 }
 
 bool MovhLoc16AccShift2_8Objmode0::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -3605,10 +3626,11 @@ bool MovhLoc16AccShift2_8Objmode0::Text(
   return true;
 }
 
-bool MovhLoc16P::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovhLoc16P::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -3623,10 +3645,11 @@ bool MovhLoc16P::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -3641,7 +3664,8 @@ bool MovlAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlAccPShiftPm::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlAccPShiftPm::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
   len = GetLength();
@@ -3657,10 +3681,11 @@ bool MovlAccPShiftPm::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Acc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -3675,10 +3700,11 @@ bool MovlLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlLoc32AccCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32AccCond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                            size_t& len,
                             std::vector<BN::InstructionTextToken>& result,
                             const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   const auto cond = GetCond(dataOp);
   len = GetLength();
@@ -3696,10 +3722,11 @@ bool MovlLoc32AccCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlLoc32P::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32P::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -3714,90 +3741,99 @@ bool MovlLoc32P::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlLoc32Xar0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 0, loc32, amode, result);
 }
 
-bool MovlLoc32Xar1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 1, loc32, amode, result);
 }
 
-bool MovlLoc32Xar2::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar2::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 2, loc32, amode, result);
 }
 
-bool MovlLoc32Xar3::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar3::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 3, loc32, amode, result);
 }
 
-bool MovlLoc32Xar4::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar4::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 4, loc32, amode, result);
 }
 
-bool MovlLoc32Xar5::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar5::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 5, loc32, amode, result);
 }
 
-bool MovlLoc32Xar6::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar6::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 6, loc32, amode, result);
 }
 
-bool MovlLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xar7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpLoc32Xarn(op_name, 7, loc32, amode, result);
 }
 
-bool MovlLoc32Xt::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlLoc32Xt::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -3812,8 +3848,8 @@ bool MovlLoc32Xt::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlPAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool MovlPAcc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -3826,10 +3862,11 @@ bool MovlPAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlPLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -3844,90 +3881,99 @@ bool MovlPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar0Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar0Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 0, loc32, amode, result);
 }
 
-bool MovlXar1Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar1Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 1, loc32, amode, result);
 }
 
-bool MovlXar2Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar2Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 2, loc32, amode, result);
 }
 
-bool MovlXar3Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar3Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 3, loc32, amode, result);
 }
 
-bool MovlXar4Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar4Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 4, loc32, amode, result);
 }
 
-bool MovlXar5Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar5Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 5, loc32, amode, result);
 }
 
-bool MovlXar6Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar6Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 6, loc32, amode, result);
 }
 
-bool MovlXar7Loc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar7Loc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
   return TextOpXarnLoc32(op_name, 7, loc32, amode, result);
 }
 
-bool MovlXar0Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar0Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -3936,10 +3982,11 @@ bool MovlXar0Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar1Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar1Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -3948,10 +3995,11 @@ bool MovlXar1Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar2Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar2Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -3960,10 +4008,11 @@ bool MovlXar2Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar3Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar3Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -3972,10 +4021,11 @@ bool MovlXar3Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar4Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar4Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -3984,10 +4034,11 @@ bool MovlXar4Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar5Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar5Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -3996,10 +4047,11 @@ bool MovlXar5Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar6Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar6Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -4008,10 +4060,11 @@ bool MovlXar6Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXar7Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXar7Const22::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const22 = GetConst22(dataOp);
   len = GetLength();
 
@@ -4020,10 +4073,11 @@ bool MovlXar7Const22::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovlXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovlXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -4038,10 +4092,11 @@ bool MovlXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovpTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovpTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4056,10 +4111,11 @@ bool MovpTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovsTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovsTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4074,10 +4130,11 @@ bool MovsTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovuAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4092,10 +4149,11 @@ bool MovuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovuLoc16Ovc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovuLoc16Ovc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4110,10 +4168,11 @@ bool MovuLoc16Ovc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovuOvcLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovuOvcLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4128,10 +4187,11 @@ bool MovuOvcLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovwDpConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovwDpConst16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -4144,10 +4204,11 @@ bool MovwDpConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovxTlLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovxTlLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4162,90 +4223,99 @@ bool MovxTlLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MovzAr0Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr0Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 0, loc16, amode, result);
 }
 
-bool MovzAr1Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr1Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 1, loc16, amode, result);
 }
 
-bool MovzAr2Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr2Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 2, loc16, amode, result);
 }
 
-bool MovzAr3Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr3Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 3, loc16, amode, result);
 }
 
-bool MovzAr4Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr4Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 4, loc16, amode, result);
 }
 
-bool MovzAr5Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr5Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 5, loc16, amode, result);
 }
 
-bool MovzAr6Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr6Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 6, loc16, amode, result);
 }
 
-bool MovzAr7Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzAr7Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
   return TextOpArnLoc16(op_name, 7, loc16, amode, result);
 }
 
-bool MovzDpConst10::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MovzDpConst10::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const10 = GetConst10(dataOp);
   len = GetLength();
 
@@ -4258,10 +4328,11 @@ bool MovzDpConst10::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyAccLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyAccLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -4279,10 +4350,11 @@ bool MpyAccLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyAccTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyAccTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4299,10 +4371,11 @@ bool MpyAccTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyPLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyPLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                            size_t& len,
                             std::vector<BN::InstructionTextToken>& result,
                             const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -4320,10 +4393,11 @@ bool MpyPLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyPTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4340,10 +4414,11 @@ bool MpyPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyaPLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyaPLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -4361,10 +4436,11 @@ bool MpyaPLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyaPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyaPTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4381,10 +4457,11 @@ bool MpyaPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpybAccTConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpybAccTConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -4399,10 +4476,11 @@ bool MpybAccTConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpybPTConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpybPTConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -4417,10 +4495,11 @@ bool MpybPTConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpysPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpysPTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4437,10 +4516,11 @@ bool MpysPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyuPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyuPTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4457,10 +4537,11 @@ bool MpyuPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyuAccTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyuAccTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4477,10 +4558,11 @@ bool MpyuAccTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyxuAccTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyxuAccTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4497,10 +4579,11 @@ bool MpyxuAccTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool MpyxuPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool MpyxuPTLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4517,7 +4600,7 @@ bool MpyxuPTLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Nasp::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Nasp::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -4527,7 +4610,7 @@ bool Nasp::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NegAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NegAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -4539,10 +4622,10 @@ bool NegAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NegAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NegAx::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -4554,8 +4637,8 @@ bool NegAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Neg64AccP::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool Neg64AccP::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -4568,8 +4651,8 @@ bool Neg64AccP::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NegtcAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool NegtcAcc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -4580,10 +4663,11 @@ bool NegtcAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NopIndArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NopIndArpn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetInd(dataOp);  // ind is a subset of loc16/32 mode
   len = GetLength();
 
@@ -4596,7 +4680,8 @@ bool NopIndArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccInd::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccInd::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -4610,7 +4695,8 @@ bool NormAccInd::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccIndPostinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccIndPostinc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
   len = GetLength();
@@ -4625,7 +4711,8 @@ bool NormAccIndPostinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccIndPostdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccIndPostdec::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
   len = GetLength();
@@ -4640,7 +4727,8 @@ bool NormAccIndPostdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccInd0Postinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccInd0Postinc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
   len = GetLength();
@@ -4656,7 +4744,8 @@ bool NormAccInd0Postinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccInd0Postdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccInd0Postdec::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
   len = GetLength();
@@ -4671,10 +4760,11 @@ bool NormAccInd0Postdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccXarnPostinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccXarnPostinc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto n = GetRegN(dataOp);
   len = GetLength();
 
@@ -4689,10 +4779,11 @@ bool NormAccXarnPostinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NormAccXarnPostdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NormAccXarnPostdec::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto n = GetRegN(dataOp);
   len = GetLength();
 
@@ -4707,7 +4798,7 @@ bool NormAccXarnPostdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NotAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NotAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -4719,10 +4810,10 @@ bool NotAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool NotAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool NotAx::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   len = GetLength();
 
@@ -4734,10 +4825,11 @@ bool NotAx::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OrAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -4752,11 +4844,11 @@ bool OrAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrAccConst16Shift0_15::Text(const uint8_t* data, uint64_t addr,
-                                 size_t& len,
+bool OrAccConst16Shift0_15::Text(const DecodedInstruction& decoded,
+                                 uint64_t addr, size_t& len,
                                  std::vector<BN::InstructionTextToken>& result,
                                  const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -4772,10 +4864,11 @@ bool OrAccConst16Shift0_15::Text(const uint8_t* data, uint64_t addr,
   return true;
 }
 
-bool OrAccConst16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OrAccConst16Shift16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -4790,10 +4883,10 @@ bool OrAccConst16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool OrAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -4809,10 +4902,11 @@ bool OrAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrIerConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OrIerConst16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -4825,10 +4919,11 @@ bool OrIerConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrIfrConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OrIfrConst16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -4841,10 +4936,11 @@ bool OrIfrConst16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OrLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -4860,10 +4956,10 @@ bool OrLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool OrLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -4880,10 +4976,11 @@ bool OrLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OrbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OrbAxConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
@@ -4898,10 +4995,11 @@ bool OrbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool OutPaLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool OutPaLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -4918,8 +5016,8 @@ bool OutPaLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopAr1Ar0::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool PopAr1Ar0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -4932,8 +5030,8 @@ bool PopAr1Ar0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopAr3Ar2::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool PopAr3Ar2::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -4946,8 +5044,8 @@ bool PopAr3Ar2::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopAr5Ar4::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool PopAr5Ar4::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -4960,7 +5058,8 @@ bool PopAr5Ar4::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopAr1hAr0h::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopAr1hAr0h::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
   len = GetLength();
@@ -4974,8 +5073,8 @@ bool PopAr1hAr0h::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopDbgier::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool PopDbgier::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -4986,7 +5085,7 @@ bool PopDbgier::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopDp::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopDp::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -4998,8 +5097,8 @@ bool PopDp::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopDpSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool PopDpSt1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -5012,7 +5111,7 @@ bool PopDpSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopIfr::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopIfr::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5024,10 +5123,10 @@ bool PopIfr::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool PopLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5040,7 +5139,7 @@ bool PopLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopP::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopP::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -5052,7 +5151,7 @@ bool PopP::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopRpc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopRpc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5064,7 +5163,7 @@ bool PopRpc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopSt0::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5076,7 +5175,7 @@ bool PopSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopSt1::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5088,8 +5187,8 @@ bool PopSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopTSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool PopTSt0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -5102,7 +5201,7 @@ bool PopTSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PopXt::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PopXt::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -5114,10 +5213,11 @@ bool PopXt::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PreadLoc16Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PreadLoc16Xar7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5132,7 +5232,8 @@ bool PreadLoc16Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushAr1Ar0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushAr1Ar0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -5146,7 +5247,8 @@ bool PushAr1Ar0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushAr3Ar2::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushAr3Ar2::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -5160,7 +5262,8 @@ bool PushAr3Ar2::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushAr5Ar4::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushAr5Ar4::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -5174,7 +5277,8 @@ bool PushAr5Ar4::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushAr1hAr0h::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushAr1hAr0h::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
   len = GetLength();
@@ -5188,7 +5292,8 @@ bool PushAr1hAr0h::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushDbgier::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushDbgier::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
   len = GetLength();
@@ -5200,7 +5305,7 @@ bool PushDbgier::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushDp::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushDp::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5212,8 +5317,8 @@ bool PushDp::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushDpSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool PushDpSt1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -5226,8 +5331,8 @@ bool PushDpSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushIfr::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool PushIfr::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -5238,10 +5343,10 @@ bool PushIfr::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool PushLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5254,7 +5359,7 @@ bool PushLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushP::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushP::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result,
                  const AddressMode amode) {
   len = GetLength();
@@ -5266,8 +5371,8 @@ bool PushP::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushRpc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool PushRpc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -5278,8 +5383,8 @@ bool PushRpc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool PushSt0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -5290,8 +5395,8 @@ bool PushSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool PushSt1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -5302,8 +5407,8 @@ bool PushSt1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushTSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool PushTSt0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
   len = GetLength();
 
@@ -5316,7 +5421,7 @@ bool PushTSt0::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PushXt::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PushXt::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5328,10 +5433,11 @@ bool PushXt::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool PwriteXar7Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool PwriteXar7Loc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5346,10 +5452,11 @@ bool PwriteXar7Loc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmaclPLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmaclPLoc32Xar7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5366,11 +5473,11 @@ bool QmaclPLoc32Xar7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmaclPLoc32Xar7Postinc::Text(const uint8_t* data, uint64_t addr,
-                                  size_t& len,
+bool QmaclPLoc32Xar7Postinc::Text(const DecodedInstruction& decoded,
+                                  uint64_t addr, size_t& len,
                                   std::vector<BN::InstructionTextToken>& result,
                                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5389,10 +5496,11 @@ bool QmaclPLoc32Xar7Postinc::Text(const uint8_t* data, uint64_t addr,
   return true;
 }
 
-bool QmpyalPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmpyalPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5409,10 +5517,11 @@ bool QmpyalPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmpylPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmpylPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5429,10 +5538,11 @@ bool QmpylPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmpylAccXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmpylAccXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5449,10 +5559,11 @@ bool QmpylAccXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmpyslPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmpyslPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5469,10 +5580,11 @@ bool QmpyslPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmpyulPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmpyulPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5489,10 +5601,11 @@ bool QmpyulPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool QmpyxulPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool QmpyxulPXtLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -5509,7 +5622,7 @@ bool QmpyxulPXtLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RolAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool RolAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5521,7 +5634,7 @@ bool RolAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RorAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool RorAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5533,10 +5646,10 @@ bool RorAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RptConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool RptConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -5547,10 +5660,10 @@ bool RptConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool RptLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool RptLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5563,7 +5676,7 @@ bool RptLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SatAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SatAcc::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5575,8 +5688,8 @@ bool SatAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Sat64AccP::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool Sat64AccP::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
   len = GetLength();
 
@@ -5589,10 +5702,11 @@ bool Sat64AccP::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbOff8Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SbOff8Cond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off8 = GetOff8(dataOp);
   const auto cond = GetCond(dataOp);
   len = GetLength();
@@ -5607,10 +5721,11 @@ bool SbOff8Cond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbbuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SbbuAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5625,10 +5740,10 @@ bool SbbuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbfOff8Eq::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool SbfOff8Eq::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off8 = GetOff8(dataOp);
   len = GetLength();
 
@@ -5642,10 +5757,11 @@ bool SbfOff8Eq::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbfOff8Neq::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SbfOff8Neq::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off8 = GetOff8(dataOp);
   len = GetLength();
 
@@ -5659,10 +5775,10 @@ bool SbfOff8Neq::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbfOff8Tc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool SbfOff8Tc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off8 = GetOff8(dataOp);
   len = GetLength();
 
@@ -5676,10 +5792,11 @@ bool SbfOff8Tc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbfOff8Ntc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SbfOff8Ntc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto off8 = GetOff8(dataOp);
   len = GetLength();
 
@@ -5693,10 +5810,11 @@ bool SbfOff8Ntc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SbrkConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SbrkConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -5707,10 +5825,10 @@ bool SbrkConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SetcMode::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool SetcMode::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto mode = GetMode(dataOp);
   len = GetLength();
 
@@ -5721,7 +5839,8 @@ bool SetcMode::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SetcM0M1Map::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SetcM0M1Map::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
   len = GetLength();
@@ -5733,7 +5852,8 @@ bool SetcM0M1Map::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SetcObjmode::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SetcObjmode::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
   len = GetLength();
@@ -5745,7 +5865,7 @@ bool SetcObjmode::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SetcXf::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SetcXf::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result,
                   const AddressMode amode) {
   len = GetLength();
@@ -5757,10 +5877,11 @@ bool SetcXf::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SfrAccShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SfrAccShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto shift = GetShift(dataOp);
   len = GetLength();
 
@@ -5773,8 +5894,8 @@ bool SfrAccShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SfrAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool SfrAccT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -5787,10 +5908,10 @@ bool SfrAccT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SpmShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                    std::vector<BN::InstructionTextToken>& result,
+bool SpmShift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                    size_t& len, std::vector<BN::InstructionTextToken>& result,
                     const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto pm = GetPM(dataOp);
   len = GetLength();
 
@@ -5801,10 +5922,10 @@ bool SpmShift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SqraLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool SqraLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5817,10 +5938,10 @@ bool SqraLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SqrsLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool SqrsLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5833,10 +5954,11 @@ bool SqrsLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubAccLoc16Objmode1::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubAccLoc16Objmode1::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5851,10 +5973,11 @@ bool SubAccLoc16Objmode1::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubAccLoc16Objmode0::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubAccLoc16Objmode0::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5870,9 +5993,9 @@ bool SubAccLoc16Objmode0::Text(const uint8_t* data, uint64_t addr, size_t& len,
 }
 
 bool SubAccLoc16Shift1_15Objmode1::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -5891,9 +6014,9 @@ bool SubAccLoc16Shift1_15Objmode1::Text(
 }
 
 bool SubAccLoc16Shift1_15Objmode0::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -5911,10 +6034,11 @@ bool SubAccLoc16Shift1_15Objmode0::Text(
   return true;
 }
 
-bool SubAccLoc16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubAccLoc16Shift16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5931,10 +6055,11 @@ bool SubAccLoc16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubAccLoc16ShiftT::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubAccLoc16ShiftT::Text(const DecodedInstruction& decoded, uint64_t addr,
+                             size_t& len,
                              std::vector<BN::InstructionTextToken>& result,
                              const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -5951,10 +6076,11 @@ bool SubAccLoc16ShiftT::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubAccConst16Shift::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubAccConst16Shift::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -5970,10 +6096,11 @@ bool SubAccConst16Shift::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -5990,10 +6117,11 @@ bool SubAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -6010,10 +6138,11 @@ bool SubLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubbAccConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubbAccConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
 
@@ -6026,10 +6155,11 @@ bool SubbAccConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubbSpConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubbSpConst7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const7 = GetConst7(dataOp);
   len = GetLength();
 
@@ -6042,10 +6172,11 @@ bool SubbSpConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubbXarnConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubbXarnConst7::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto n = GetRegN(dataOp);
   const auto const7 = GetConst7(dataOp);
   len = GetLength();
@@ -6060,10 +6191,11 @@ bool SubbXarnConst7::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubblAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubblAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6078,10 +6210,11 @@ bool SubblAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubcuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubcuAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6096,10 +6229,11 @@ bool SubcuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubculAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubculAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6114,10 +6248,11 @@ bool SubculAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SublAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SublAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6132,10 +6267,11 @@ bool SublAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SublLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SublLoc32Acc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6150,10 +6286,11 @@ bool SublLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubrLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubrLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
@@ -6170,10 +6307,11 @@ bool SubrLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubrlLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubrlLoc32Acc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6188,10 +6326,11 @@ bool SubrlLoc32Acc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubuAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6206,10 +6345,11 @@ bool SubuAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubulAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubulAccLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6224,10 +6364,11 @@ bool SubulAccLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool SubulPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool SubulPLoc32::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc32 = GetLoc32(dataOp);
   len = GetLength();
 
@@ -6242,10 +6383,11 @@ bool SubulPLoc32::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TbitLoc16Bit::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool TbitLoc16Bit::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto bit = GetBitIndex(dataOp);
   len = GetLength();
@@ -6261,10 +6403,11 @@ bool TbitLoc16Bit::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TbitLoc16T::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool TbitLoc16T::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6279,10 +6422,11 @@ bool TbitLoc16T::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TclrLoc16Bit::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool TclrLoc16Bit::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto bit = GetBitIndex(dataOp);
   len = GetLength();
@@ -6298,8 +6442,8 @@ bool TclrLoc16Bit::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TestAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool TestAcc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -6310,10 +6454,10 @@ bool TestAcc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TrapVec::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool TrapVec::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto vec = GetVec(dataOp);
   len = GetLength();
 
@@ -6324,10 +6468,11 @@ bool TrapVec::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool TsetLoc16Bit::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool TsetLoc16Bit::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto bit = GetBitIndex(dataOp);
   len = GetLength();
@@ -6343,10 +6488,11 @@ bool TsetLoc16Bit::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool UoutPaLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool UoutPaLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -6363,7 +6509,7 @@ bool UoutPaLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbAl::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbAl::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -6375,10 +6521,10 @@ bool XbAl::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbPmaArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool XbPmaArpn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto n = GetRegN(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -6390,15 +6536,15 @@ bool XbPmaArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   OpsepText(result);
   result.emplace_back(OperationToken, "*");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
-bool XbPmaCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool XbPmaCond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto cond = GetCond(dataOp);
   len = GetLength();
@@ -6413,10 +6559,11 @@ bool XbPmaCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbanzPmaInd::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbanzPmaInd::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -6430,10 +6577,11 @@ bool XbanzPmaInd::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbanzPmaIndPostinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbanzPmaIndPostinc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -6448,10 +6596,11 @@ bool XbanzPmaIndPostinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbanzPmaIndPostdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbanzPmaIndPostdec::Text(const DecodedInstruction& decoded, uint64_t addr,
+                              size_t& len,
                               std::vector<BN::InstructionTextToken>& result,
                               const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -6466,10 +6615,11 @@ bool XbanzPmaIndPostdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbanzPmaInd0Postinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbanzPmaInd0Postinc::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -6485,10 +6635,11 @@ bool XbanzPmaInd0Postinc::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbanzPmaInd0Postdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbanzPmaInd0Postdec::Text(const DecodedInstruction& decoded, uint64_t addr,
+                               size_t& len,
                                std::vector<BN::InstructionTextToken>& result,
                                const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -6504,10 +6655,11 @@ bool XbanzPmaInd0Postdec::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XbanzPmaIndArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XbanzPmaIndArpn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -6519,16 +6671,16 @@ bool XbanzPmaIndArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   OpsepText(result);
   result.emplace_back(OperationToken, "*");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
-bool XbanzPmaIndPostincArpn::Text(const uint8_t* data, uint64_t addr,
-                                  size_t& len,
+bool XbanzPmaIndPostincArpn::Text(const DecodedInstruction& decoded,
+                                  uint64_t addr, size_t& len,
                                   std::vector<BN::InstructionTextToken>& result,
                                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -6541,16 +6693,16 @@ bool XbanzPmaIndPostincArpn::Text(const uint8_t* data, uint64_t addr,
   result.emplace_back(OperationToken, "*");
   result.emplace_back(OperationToken, "++");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
-bool XbanzPmaIndPostdecArpn::Text(const uint8_t* data, uint64_t addr,
-                                  size_t& len,
+bool XbanzPmaIndPostdecArpn::Text(const DecodedInstruction& decoded,
+                                  uint64_t addr, size_t& len,
                                   std::vector<BN::InstructionTextToken>& result,
                                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -6563,15 +6715,15 @@ bool XbanzPmaIndPostdecArpn::Text(const uint8_t* data, uint64_t addr,
   result.emplace_back(OperationToken, "*");
   result.emplace_back(OperationToken, "--");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
 bool XbanzPmaInd0PostincArpn::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -6585,15 +6737,15 @@ bool XbanzPmaInd0PostincArpn::Text(
   result.emplace_back(TextToken, "0");
   result.emplace_back(OperationToken, "++");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
 bool XbanzPmaInd0PostdecArpn::Text(
-    const uint8_t* data, uint64_t addr, size_t& len,
+    const DecodedInstruction& decoded, uint64_t addr, size_t& len,
     std::vector<BN::InstructionTextToken>& result, const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -6607,13 +6759,13 @@ bool XbanzPmaInd0PostdecArpn::Text(
   result.emplace_back(TextToken, "0");
   result.emplace_back(OperationToken, "--");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
-bool XcallAl::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                   std::vector<BN::InstructionTextToken>& result,
+bool XcallAl::Text(const DecodedInstruction& decoded, uint64_t addr,
+                   size_t& len, std::vector<BN::InstructionTextToken>& result,
                    const AddressMode amode) {
   len = GetLength();
 
@@ -6624,10 +6776,11 @@ bool XcallAl::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XcallPmaArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XcallPmaArpn::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto n = GetRegN(dataOp);
   len = GetLength();
@@ -6639,15 +6792,16 @@ bool XcallPmaArpn::Text(const uint8_t* data, uint64_t addr, size_t& len,
   OpsepText(result);
   result.emplace_back(OperationToken, "*");
   OpsepText(result);
-  result.emplace_back(TextToken, std::format("arp{}", n));
+  ArpText(n, result);
 
   return true;
 }
 
-bool XcallPmaCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XcallPmaCond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto cond = GetCond(dataOp);
   len = GetLength();
@@ -6662,10 +6816,11 @@ bool XcallPmaCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XmacPLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XmacPLoc16Pma::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -6686,10 +6841,11 @@ bool XmacPLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XmacdPLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XmacdPLoc16Pma::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -6710,10 +6866,11 @@ bool XmacdPLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XorAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XorAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                       size_t& len,
                        std::vector<BN::InstructionTextToken>& result,
                        const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6728,11 +6885,11 @@ bool XorAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XorAccConst16Shift0_15::Text(const uint8_t* data, uint64_t addr,
-                                  size_t& len,
+bool XorAccConst16Shift0_15::Text(const DecodedInstruction& decoded,
+                                  uint64_t addr, size_t& len,
                                   std::vector<BN::InstructionTextToken>& result,
                                   const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   const auto shift = GetShift(dataOp);
   len = GetLength();
@@ -6748,10 +6905,11 @@ bool XorAccConst16Shift0_15::Text(const uint8_t* data, uint64_t addr,
   return true;
 }
 
-bool XorAccConst16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XorAccConst16Shift16::Text(const DecodedInstruction& decoded,
+                                uint64_t addr, size_t& len,
                                 std::vector<BN::InstructionTextToken>& result,
                                 const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
 
@@ -6766,10 +6924,11 @@ bool XorAccConst16Shift16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XorAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XorAxLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -6786,10 +6945,11 @@ bool XorAxLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XorLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XorLoc16Ax::Text(const DecodedInstruction& decoded, uint64_t addr,
+                      size_t& len,
                       std::vector<BN::InstructionTextToken>& result,
                       const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto x = GetRegAx(dataOp);
   len = GetLength();
@@ -6806,10 +6966,11 @@ bool XorLoc16Ax::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XorLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XorLoc16Const16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                           size_t& len,
                            std::vector<BN::InstructionTextToken>& result,
                            const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -6826,10 +6987,11 @@ bool XorLoc16Const16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XorbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XorbAxConst8::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto x = GetRegAx(dataOp);
   const auto const8 = GetConst8(dataOp);
   len = GetLength();
@@ -6844,10 +7006,11 @@ bool XorbAxConst8::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XpreadLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XpreadLoc16Pma::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   const auto const16 = GetConst16(dataOp);
   len = GetLength();
@@ -6866,10 +7029,11 @@ bool XpreadLoc16Pma::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XpreadLoc16Al::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XpreadLoc16Al::Text(const DecodedInstruction& decoded, uint64_t addr,
+                         size_t& len,
                          std::vector<BN::InstructionTextToken>& result,
                          const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6884,10 +7048,11 @@ bool XpreadLoc16Al::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XpwriteAlLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool XpwriteAlLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                          size_t& len,
                           std::vector<BN::InstructionTextToken>& result,
                           const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6902,10 +7067,10 @@ bool XpwriteAlLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool XretcCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
-                     std::vector<BN::InstructionTextToken>& result,
+bool XretcCond::Text(const DecodedInstruction& decoded, uint64_t addr,
+                     size_t& len, std::vector<BN::InstructionTextToken>& result,
                      const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto cond = GetCond(dataOp);
   len = GetLength();
 
@@ -6916,10 +7081,11 @@ bool XretcCond::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool ZalrAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool ZalrAccLoc16::Text(const DecodedInstruction& decoded, uint64_t addr,
+                        size_t& len,
                         std::vector<BN::InstructionTextToken>& result,
                         const AddressMode amode) {
-  const auto dataOp = DataToOpcode(data, GetLength());
+  const auto dataOp = decoded.word;
   const auto loc16 = GetLoc16(dataOp);
   len = GetLength();
 
@@ -6934,7 +7100,7 @@ bool ZalrAccLoc16::Text(const uint8_t* data, uint64_t addr, size_t& len,
   return true;
 }
 
-bool Zapa::Text(const uint8_t* data, uint64_t addr, size_t& len,
+bool Zapa::Text(const DecodedInstruction& decoded, uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result,
                 const AddressMode amode) {
   len = GetLength();
@@ -8,6 +8,7 @@
 
 #include <vector>
 
+#include "addressing.h"
 #include "instructions.h"
 
 namespace BN = BinaryNinja;
@@ -43,10 +44,11 @@ inline void OpsepText(std::vector<BN::InstructionTextToken>& result);
 inline void RegCombineText(std::vector<BN::InstructionTextToken>& result);
 inline void LshiftText(std::vector<BN::InstructionTextToken>& result);
 void RegText(RegTextInfo rti, std::vector<BN::InstructionTextToken>& result);
+void ArpText(uint8_t n, std::vector<BN::InstructionTextToken>& result);
 void ConstText(const ConstTextInfo& cti,
                std::vector<BN::InstructionTextToken>& result);
-bool loc_text_helper(const LocTextInfo& lti,
-                     std::vector<BN::InstructionTextToken>& result);
+bool LocText(const LocMode& mode,
+             std::vector<BN::InstructionTextToken>& result);
 bool Loc16Text(const LocTextInfo& lti,
                std::vector<BN::InstructionTextToken>& result);
 bool Loc32Text(const LocTextInfo& lti,
@@ -65,6 +67,7 @@ void TextOpXarnConst22(char* op_name, uint8_t n, uint32_t const22,
                        std::vector<BN::InstructionTextToken>& result);
 bool TextOpArnLoc16(char* op_name, uint8_t n, uint8_t loc16, AddressMode amode,
                     std::vector<BN::InstructionTextToken>& result);
+size_t SampleTextTokens(uint16_t id);
 }  // namespace TIC28X
 
 #endif  // TIC28X_TEXT_H
@@ -0,0 +1,140 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+/**
+ * text_bench - measures heap allocations and time per rendered line of
+ * disassembly.
+ *
+ * Every instruction is rendered from its base encoding, the way the linear
+ * view asks for one line at a time:
+ *  - unreserved: Instruction::Text into a fresh vector, which grows as tokens
+ *    are appended (the behaviour before the vector was reserved)
+ *  - reserved: GetInstructionText with the text cache disabled, which sizes
+ *    the vector once from the instruction's Registry::MAX_TOKENS
+ *  - cached: GetInstructionText with the default text cache
+ *
+ * Allocations are counted by replacing the global operator new, which also
+ * catches allocations made inside the plugin library on ELF and Mach-O
+ * platforms.
+ *
+ * Usage: tic28x_text_bench [passes]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "architecture.h"
+#include "decoder.h"
+#include "registry.h"
+
+namespace {
+std::atomic<uint64_t> ALLOCATIONS = 0;
+}  // namespace
+
+void* operator new(const size_t size) {
+  ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+using TIC28X::Registry;
+
+// Little-endian bytes of every instruction's base encoding in an object mode
+std::vector<std::vector<uint8_t>> BaseEncodings(
+    const TIC28X::ObjectMode objmode) {
+  std::vector<std::vector<uint8_t>> lines;
+  for (size_t i = 0; i < Registry::COUNT; i++) {
+    if (Registry::OBJMODES[i] != TIC28X::OBJMODE_ANY &&
+        Registry::OBJMODES[i] != objmode) {
+      continue;
+    }
+    const uint32_t op = Registry::OPCODES[i];
+    if (Registry::LENGTHS[i] == TIC28X::Sizes::_2_BYTES) {
+      lines.push_back({static_cast<uint8_t>(op & 0xFF),
+                       static_cast<uint8_t>(op >> 8 & 0xFF)});
+    } else {
+      lines.push_back({static_cast<uint8_t>(op >> 16 & 0xFF),
+                       static_cast<uint8_t>(op >> 24),
+                       static_cast<uint8_t>(op & 0xFF),
+                       static_cast<uint8_t>(op >> 8 & 0xFF)});
+    }
+  }
+  return lines;
+}
+
+template <class Render>
+void Measure(const char* name, const size_t passes,
+             const std::vector<std::vector<uint8_t>>& lines,
+             const Render& render) {
+  // One untimed pass warms up the caches
+  for (const auto& line : lines) {
+    render(line);
+  }
+
+  size_t rendered = 0;
+  const uint64_t before = ALLOCATIONS.load();
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t pass = 0; pass < passes; pass++) {
+    for (const auto& line : lines) {
+      rendered += render(line);
+    }
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const uint64_t allocations = ALLOCATIONS.load() - before;
+
+  const double ns =
+      std::chrono::duration<double, std::nano>(elapsed).count() / rendered;
+  std::printf("%-12s %8zu lines %8.2f allocations/line %8.1f ns/line\n", name,
+              rendered, static_cast<double>(allocations) / rendered, ns);
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  const size_t passes = argc > 1 ? std::stoul(argv[1]) : 100;
+  const auto objmode = TIC28X::OBJMODE_1;
+  const auto amode = TIC28X::AMODE_0;
+  const auto lines = BaseEncodings(objmode);
+  const auto& table = TIC28X::GetDecodeTable(objmode);
+
+  Measure("unreserved", passes, lines, [&](const std::vector<uint8_t>& line) {
+    const auto decoded = TIC28X::Decode(line.data(), 0, table);
+    if (!decoded) {
+      return 0;
+    }
+    size_t len = 0;
+    std::vector<BN::InstructionTextToken> tokens;
+    return static_cast<int>(TIC28X::GetInstruction(*decoded)->Text(
+        *decoded, 0, len, tokens, amode));
+  });
+
+  const auto reserved = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-bench", objmode, amode, 0);
+  Measure("reserved", passes, lines, [&](const std::vector<uint8_t>& line) {
+    size_t len = 0;
+    std::vector<BN::InstructionTextToken> tokens;
+    return static_cast<int>(
+        reserved->GetInstructionText(line.data(), 0, len, tokens));
+  });
+
+  const auto cached = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-bench", objmode, amode);
+  Measure("cached", passes, lines, [&](const std::vector<uint8_t>& line) {
+    size_t len = 0;
+    std::vector<BN::InstructionTextToken> tokens;
+    return static_cast<int>(
+        cached->GetInstructionText(line.data(), 0, len, tokens));
+  });
+  return 0;
+}
@@ -8,9 +8,16 @@
 #include <gtest/gtest.h>
 
 #include <format>
+#include <limits>
 
 #include "architecture.h"
+#include "conditions.h"
+#include "flags.h"
 #include "instructions.h"
+#include "registers.h"
+#include "registry.h"
+#include "text.h"
+#include "util.h"
 
 constexpr uint32_t TEST_DATA = 0xFFFFFFFF;
 
@@ -71,14 +78,117 @@ static void test_architecture_text(
 
   size_t len = 0;
   auto got = std::vector<BN::InstructionTextToken>{};
-  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>("tic28x-test");
-  arch->SetObjmode(objmode);  // set operating object mode
+  const auto arch =
+      std::make_unique<TIC28X::TIC28XArchitecture>("tic28x-test", objmode);
 
   EXPECT_TRUE(arch->GetInstructionText(full_op.data(), address, len, got));
   EXPECT_EQ(len, expected_len);
   compare_text_tokens(got, want);
 }
 
+/* Operand Text Tests */
+
+// Verify FormatHex, including signed values, which keep their sign after the
+// prefix like std::format("0x{:x}") does
+TEST(TestOperandText, FormatHex) {
+  HexBuffer buf;
+  EXPECT_EQ(FormatHex(uint64_t{0}, buf), "0x0");
+  EXPECT_EQ(FormatHex(uint64_t{0x3F0000}, buf), "0x3f0000");
+  EXPECT_EQ(FormatHex(uint64_t{0xFFFFFFFFFFFFFFFF}, buf),
+            "0xffffffffffffffff");
+  EXPECT_EQ(FormatHex(int64_t{-2}, buf), "0x-2");
+  EXPECT_EQ(FormatHex(int64_t{0x7FFF}, buf), "0x7fff");
+  EXPECT_EQ(FormatHex(std::numeric_limits<int64_t>::min(), buf),
+            "0x-8000000000000000");
+}
+
+// Verify ConstText sign extension and formatting
+TEST(TestOperandText, ConstText) {
+  std::vector<BN::InstructionTextToken> got;
+  TIC28X::ConstText(
+      TIC28X::ConstTextInfo{.value = 0xFE, .nbits = 8, .is_signed = true},
+      got);
+  compare_text_tokens(got, {{TextToken, "#"}, {IntegerToken, "0x-2"}});
+
+  got.clear();
+  TIC28X::ConstText(
+      TIC28X::ConstTextInfo{.value = 0x1234, .nbits = 8, .is_address = true},
+      got);
+  compare_text_tokens(got,
+                      {{TextToken, "@"}, {PossibleAddressToken, "0x34"}});
+}
+
+// Verify the ARP names
+TEST(TestOperandText, ArpText) {
+  std::vector<BN::InstructionTextToken> got;
+  TIC28X::ArpText(5, got);
+  compare_text_tokens(got, {{TextToken, "arp5"}});
+}
+
+// Verify that register, flag and condition names are indexed by their ids
+TEST(TestOperandText, Names) {
+  std::vector<BN::InstructionTextToken> got;
+  TIC28X::RegText(TIC28X::RegTextInfo{.regnum = TIC28X::Registers::TH}, got);
+  TIC28X::RegText(TIC28X::RegTextInfo{.regnum = TIC28X::Registers::RB}, got);
+  TIC28X::CondText(TIC28X::Conditions::LO_NC, got);
+  TIC28X::ModeText(0x1, got);
+  compare_text_tokens(got, {{RegisterToken, "th"},
+                            {RegisterToken, "rb"},
+                            {TextToken, "lo, nc"},
+                            {TextToken, "sxm"}});
+
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1);
+  EXPECT_EQ(arch->GetRegisterName(TIC28X::Registers::XAR7), "xar7");
+  EXPECT_EQ(arch->GetRegisterName(TIC28X::Registers::COUNT),
+            "INVALID_REGISTER_ID");
+  EXPECT_EQ(arch->GetFlagName(TIC28X::Flags::ARP), "arp");
+  EXPECT_EQ(arch->GetFlagName(TIC28X::Flags::COUNT), "INVALID_FLAG");
+  const auto info = arch->GetRegisterInfo(TIC28X::Registers::T);
+  EXPECT_EQ(info.fullWidthRegister, TIC28X::Registers::XT);
+  EXPECT_EQ(info.offset, 2u);
+  EXPECT_EQ(info.size, 2u);
+}
+
+// Verify that every register and flag is listed, FPU registers included, and
+// that register info agrees with Registers::INFO
+TEST(TestOperandText, AllRegistersAndFlags) {
+  const auto arch = std::make_unique<TIC28X::TIC28XArchitecture>(
+      "tic28x-test", TIC28X::OBJMODE_1);
+  const auto regs = arch->GetAllRegisters();
+  ASSERT_EQ(regs.size(), TIC28X::Registers::COUNT);
+  for (uint32_t reg = 0; reg < TIC28X::Registers::COUNT; reg++) {
+    EXPECT_EQ(regs[reg], reg);
+    const auto info = arch->GetRegisterInfo(reg);
+    EXPECT_EQ(info.fullWidthRegister, TIC28X::Registers::INFO[reg].fullWidthReg)
+        << TIC28X::Registers::NAMES[reg];
+    EXPECT_EQ(info.size, TIC28X::Registers::INFO[reg].size)
+        << TIC28X::Registers::NAMES[reg];
+  }
+  EXPECT_EQ(arch->GetRegisterInfo(TIC28X::Registers::R7H).size, 4u);
+  EXPECT_EQ(arch->GetRegisterName(TIC28X::Registers::STF), "stf");
+  EXPECT_EQ(arch->GetRegisterInfo(TIC28X::Registers::COUNT).size, 0u);
+
+  const auto flags = arch->GetAllFlags();
+  ASSERT_EQ(flags.size(), TIC28X::Flags::COUNT);
+  EXPECT_EQ(flags.front(), TIC28X::Flags::SXM);
+  EXPECT_EQ(flags.back(), TIC28X::Flags::ARP);
+}
+
+// Verify that Registry::MAX_TOKENS is exactly the most tokens each
+// instruction renders, so lines are reserved neither short nor loose. If this
+// fails, regenerate src/text_tokens.h with tic28x_text_tokens.
+TEST(TestOperandText, MaxTokens) {
+  using TIC28X::Registry;
+  for (uint16_t id = 0; id < Registry::COUNT; id++) {
+    const size_t tokens = TIC28X::SampleTextTokens(id);
+    EXPECT_EQ(tokens, Registry::MAX_TOKENS[id]) << Registry::FULL_NAMES[id];
+    // A class missing from the table still gets a bound that holds
+    EXPECT_LE(tokens, TIC28X::MaxTextTokens("", Registry::FIELDS[id]))
+        << Registry::FULL_NAMES[id];
+  }
+}
+
 /* Instruction Text Tests */
 
 // // Format: OP
@@ -0,0 +1,447 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_TEXT_TOKENS_H
+#define TIC28X_TEXT_TOKENS_H
+
+#include <array>
+#include <cstdint>
+
+namespace TIC28X {
+struct TextTokens {
+  const char* name;  // full name of the instruction class
+  uint8_t tokens;
+};
+
+/**
+ * TEXT_TOKENS - the most text tokens each instruction class renders, without
+ * the repeat prefix, as measured by SampleTextTokens. Registry::MAX_TOKENS
+ * takes its counts from here, so each line's tokens are reserved once and
+ * no more than needed.
+ *
+ * Generated by `tic28x_text_tokens src/text_tokens.h`; rerun it whenever an
+ * instruction's Text changes.
+ */
+inline constexpr std::array<TextTokens, 418> TEXT_TOKENS = {{
+    {"Aborti", 1},
+    {"AbsAcc", 3},
+    {"AbstcAcc", 3},
+    {"AddAccConst16Shift", 11},
+    {"AddAccLoc16ShiftT", 16},
+    {"AddAccLoc16", 12},
+    {"AddAccLoc16Shift1_15", 17},
+    {"AddAccLoc16Shift16", 17},
+    {"AddAccLoc16Shift0_15", 17},
+    {"AddAxLoc16", 12},
+    {"AddLoc16Ax", 12},
+    {"AddLoc16Const16", 13},
+    {"AddbAccConst8", 6},
+    {"AddbAxConst8", 6},
+    {"AddbSpConst7", 6},
+    {"AddbXarnConst7", 6},
+    {"AddclAccLoc32", 12},
+    {"AddcuAccLoc16", 12},
+    {"AddlAccLoc32", 12},
+    {"AddlAccPShiftPm", 9},
+    {"AddlLoc32Acc", 12},
+    {"AdduAccLoc16", 12},
+    {"AddulPLoc32", 12},
+    {"AddulAccLoc32", 12},
+    {"AdrkImm8", 4},
+    {"AndAccConst16Shift0_15", 11},
+    {"AndAccConst16Shift16", 11},
+    {"AndAccLoc16", 12},
+    {"AndAxLoc16Const16", 15},
+    {"AndIerConst16", 6},
+    {"AndIfrConst16", 6},
+    {"AndLoc16Ax", 12},
+    {"AndAxLoc16", 12},
+    {"AndLoc16Const16", 13},
+    {"AndbAxConst8", 6},
+    {"Asp", 1},
+    {"AsrAxShift", 6},
+    {"AsrAxT", 5},
+    {"Asr64AccPShift", 8},
+    {"Asr64AccPT", 7},
+    {"AsrlAccT", 5},
+    {"BOff16Cond", 6},
+    {"BanzOff16Arn", 7},
+    {"BarOff16ArnArmEq", 10},
+    {"BarOff16ArnArmNeq", 10},
+    {"BfOff16Cond", 6},
+    {"ClrcAmode", 1},
+    {"ClrcM0M1Map", 1},
+    {"ClrcObjmode", 1},
+    {"ClrcOvc", 1},
+    {"ClrcXf", 1},
+    {"ClrcMode", 17},
+    {"CmpAxLoc16", 12},
+    {"CmpLoc16Const16", 13},
+    {"Cmp64AccP", 5},
+    {"CmpbAxConst8", 6},
+    {"CmplAccLoc32", 12},
+    {"CmplAccPShiftPm", 9},
+    {"Cmpr0", 1},
+    {"Cmpr1", 1},
+    {"Cmpr2", 1},
+    {"Cmpr3", 1},
+    {"CsbAcc", 3},
+    {"DecLoc16", 10},
+    {"DmacAccPLoc32Xar7", 17},
+    {"DmacAccPLoc32Xar7Postinc", 18},
+    {"DmovLoc16", 10},
+    {"Eallow", 1},
+    {"Edis", 1},
+    {"Estop0", 1},
+    {"Estop1", 1},
+    {"FfcXar7Const22", 6},
+    {"FlipAx", 3},
+    {"IackConst16", 4},
+    {"Idle", 1},
+    {"ImaclPLoc32Xar7", 15},
+    {"ImaclPLoc32Xar7Postinc", 16},
+    {"ImpyalPXtLoc32", 14},
+    {"ImpylAccXtLoc32", 14},
+    {"ImpylPXtLoc32", 14},
+    {"ImpyslPXtLoc32", 14},
+    {"ImpyxulPXtLoc32", 14},
+    {"InLoc16Pa", 15},
+    {"IncLoc16", 10},
+    {"IntrIntx", 3},
+    {"IntrNmi", 1},
+    {"IntrEmuint", 1},
+    {"Iret", 1},
+    {"LbXar7", 4},
+    {"LbConst22", 4},
+    {"LcXar7", 4},
+    {"LcConst22", 4},
+    {"LcrConst22", 4},
+    {"LcrXarn", 4},
+    {"LoopnzLoc16Const16", 13},
+    {"LoopzLoc16Const16", 13},
+    {"Lpaddr", 1},
+    {"Lret", 1},
+    {"Lrete", 1},
+    {"Lretr", 1},
+    {"LslAccShift", 6},
+    {"LslAccT", 5},
+    {"LslAxShift", 6},
+    {"LslAxT", 5},
+    {"Lsl64AccPShift", 8},
+    {"Lsl64AccPT", 7},
+    {"LsllAccT", 5},
+    {"LsrAxShift", 6},
+    {"LsrAxT", 5},
+    {"Lsr64AccPShift", 8},
+    {"Lsr64AccPT", 7},
+    {"LsrlAccT", 5},
+    {"MacPLoc16Pma", 17},
+    {"MacPLoc16Xar7", 15},
+    {"MacPLoc16Xar7Postinc", 16},
+    {"MaxAxLoc16", 12},
+    {"MaxculPLoc32", 12},
+    {"MaxlAccLoc32", 12},
+    {"MinAxLoc16", 12},
+    {"MinculPLoc32", 12},
+    {"MinlAccLoc32", 12},
+    {"MovMem16Loc16", 15},
+    {"MovAccConst16Shift", 11},
+    {"MovAccLoc16ShiftT", 16},
+    {"MovAccLoc16Objmode1", 12},
+    {"MovAccLoc16Objmode0", 12},
+    {"MovAccLoc16Shift1_15Objmode1", 17},
+    {"MovAccLoc16Shift1_15Objmode0", 17},
+    {"MovAccLoc16Shift16", 17},
+    {"MovAr6Loc16", 12},
+    {"MovAr7Loc16", 12},
+    {"MovAxLoc16", 12},
+    {"MovDpConst10", 6},
+    {"MovIerLoc16", 12},
+    {"MovLoc16Const16", 13},
+    {"MovLoc16Mem16", 15},
+    {"MovLoc16_0", 13},
+    {"MovLoc16AccShift1", 17},
+    {"MovLoc16AccShift2_8Objmode1", 17},
+    {"MovLoc16AccShift2_8Objmode0", 17},
+    {"MovLoc16Arn", 12},
+    {"MovLoc16Ax", 12},
+    {"MovLoc16AxCond", 13},
+    {"MovLoc16Ier", 12},
+    {"MovLoc16Ovc", 12},
+    {"MovLoc16P", 12},
+    {"MovLoc16T", 12},
+    {"MovOvcLoc16", 12},
+    {"MovPhLoc16", 12},
+    {"MovPlLoc16", 12},
+    {"MovPmAx", 5},
+    {"MovTLoc16", 12},
+    {"MovTl0", 6},
+    {"MovXarnPc", 5},
+    {"MovaTLoc16", 12},
+    {"MovadTLoc16", 12},
+    {"MovbAccConst8", 6},
+    {"MovbAr6Const8", 6},
+    {"MovbAr7Const8", 6},
+    {"MovbAxConst8", 6},
+    {"MovbAxlsbLoc16", 13},
+    {"MovbAxmsbLoc16", 13},
+    {"MovbLoc16Const8Cond", 15},
+    {"MovbLoc16Axlsb", 13},
+    {"MovbLoc16Axmsb", 13},
+    {"MovbXar0Const8", 6},
+    {"MovbXar1Const8", 6},
+    {"MovbXar2Const8", 6},
+    {"MovbXar3Const8", 6},
+    {"MovbXar4Const8", 6},
+    {"MovbXar5Const8", 6},
+    {"MovbXar6Const8", 6},
+    {"MovbXar7Const8", 6},
+    {"MovdlXtLoc32", 12},
+    {"MovhLoc16AccShift1", 17},
+    {"MovhLoc16AccShift2_8Objmode1", 17},
+    {"MovhLoc16AccShift2_8Objmode0", 17},
+    {"MovhLoc16P", 12},
+    {"MovlAccLoc32", 12},
+    {"MovlAccPShiftPm", 9},
+    {"MovlLoc32Acc", 12},
+    {"MovlLoc32AccCond", 14},
+    {"MovlLoc32P", 12},
+    {"MovlLoc32Xar0", 12},
+    {"MovlLoc32Xar1", 12},
+    {"MovlLoc32Xar2", 12},
+    {"MovlLoc32Xar3", 12},
+    {"MovlLoc32Xar4", 12},
+    {"MovlLoc32Xar5", 12},
+    {"MovlLoc32Xar6", 12},
+    {"MovlLoc32Xar7", 12},
+    {"MovlLoc32Xt", 12},
+    {"MovlPAcc", 5},
+    {"MovlPLoc32", 12},
+    {"MovlXar0Loc32", 12},
+    {"MovlXar1Loc32", 12},
+    {"MovlXar2Loc32", 12},
+    {"MovlXar3Loc32", 12},
+    {"MovlXar4Loc32", 12},
+    {"MovlXar5Loc32", 12},
+    {"MovlXar6Loc32", 12},
+    {"MovlXar7Loc32", 12},
+    {"MovlXar0Const22", 6},
+    {"MovlXar1Const22", 6},
+    {"MovlXar2Const22", 6},
+    {"MovlXar3Const22", 6},
+    {"MovlXar4Const22", 6},
+    {"MovlXar5Const22", 6},
+    {"MovlXar6Const22", 6},
+    {"MovlXar7Const22", 6},
+    {"MovlXtLoc32", 12},
+    {"MovpTLoc16", 12},
+    {"MovsTLoc16", 12},
+    {"MovuAccLoc16", 12},
+    {"MovuLoc16Ovc", 12},
+    {"MovuOvcLoc16", 12},
+    {"MovwDpConst16", 6},
+    {"MovxTlLoc16", 12},
+    {"MovzAr0Loc16", 12},
+    {"MovzAr1Loc16", 12},
+    {"MovzAr2Loc16", 12},
+    {"MovzAr3Loc16", 12},
+    {"MovzAr4Loc16", 12},
+    {"MovzAr5Loc16", 12},
+    {"MovzAr6Loc16", 12},
+    {"MovzAr7Loc16", 12},
+    {"MovzDpConst10", 6},
+    {"MpyAccLoc16Const16", 15},
+    {"MpyAccTLoc16", 14},
+    {"MpyPLoc16Const16", 15},
+    {"MpyPTLoc16", 14},
+    {"MpyaPLoc16Const16", 15},
+    {"MpyaPTLoc16", 14},
+    {"MpybAccTConst8", 8},
+    {"MpybPTConst8", 8},
+    {"MpysPTLoc16", 14},
+    {"MpyuPTLoc16", 14},
+    {"MpyuAccTLoc16", 14},
+    {"MpyxuAccTLoc16", 14},
+    {"MpyxuPTLoc16", 14},
+    {"Nasp", 1},
+    {"NegAcc", 3},
+    {"NegAx", 3},
+    {"Neg64AccP", 5},
+    {"NegtcAcc", 3},
+    {"NopIndArpn", 10},
+    {"NormAccInd", 5},
+    {"NormAccIndPostinc", 6},
+    {"NormAccIndPostdec", 6},
+    {"NormAccInd0Postin", 7},
+    {"NormAccInd0Postdec", 7},
+    {"NormAccXarnPostinc", 6},
+    {"NormAccXarnPostdec", 6},
+    {"NotAcc", 3},
+    {"NotAx", 3},
+    {"OrAccLoc16", 12},
+    {"OrAccConst16Shift0_15", 11},
+    {"OrAccConst16Shift16", 11},
+    {"OrAxLoc16", 12},
+    {"OrIerConst16", 6},
+    {"OrIfrConst16", 6},
+    {"OrLoc16Const16", 13},
+    {"OrLoc16Ax", 12},
+    {"OrbAxConst8", 6},
+    {"OutPaLoc16", 15},
+    {"PopAr1Ar0", 5},
+    {"PopAr3Ar2", 5},
+    {"PopAr5Ar4", 5},
+    {"PopAr1hAr0h", 5},
+    {"PopDbgier", 3},
+    {"PopDp", 3},
+    {"PopDpSt1", 5},
+    {"PopIfr", 3},
+    {"PopLoc16", 10},
+    {"PopP", 3},
+    {"PopRpc", 3},
+    {"PopSt0", 3},
+    {"PopSt1", 3},
+    {"PopTSt0", 5},
+    {"PopXt", 3},
+    {"PreadLoc16Xar7", 13},
+    {"PushAr1Ar0", 5},
+    {"PushAr3Ar2", 5},
+    {"PushAr5Ar4", 5},
+    {"PushAr1hAr0h", 5},
+    {"PushDbgier", 3},
+    {"PushDp", 3},
+    {"PushDpSt1", 5},
+    {"PushIfr", 3},
+    {"PushLoc16", 10},
+    {"PushP", 3},
+    {"PushRpc", 3},
+    {"PushSt0", 3},
+    {"PushSt1", 3},
+    {"PushTSt0", 5},
+    {"PushXt", 3},
+    {"PwriteXar7Loc16", 13},
+    {"QmaclPLoc32Xar7", 15},
+    {"QmaclPLoc32Xar7Postinc", 16},
+    {"QmpyalPXtLoc32", 14},
+    {"QmpylPXtLoc32", 14},
+    {"QmpylAccXtLoc32", 14},
+    {"QmpyslPXtLoc32", 14},
+    {"QmpyulPXtLoc32", 14},
+    {"QmpyxulPXtLoc32", 14},
+    {"RolAcc", 3},
+    {"RorAcc", 3},
+    {"RptConst8", 4},
+    {"RptLoc16", 10},
+    {"SatAcc", 3},
+    {"Sat64AccP", 5},
+    {"SbOff8Cond", 7},
+    {"SbbuAccLoc16", 12},
+    {"SbfOff8Eq", 7},
+    {"SbfOff8Neq", 7},
+    {"SbfOff8Tc", 7},
+    {"SbfOff8Ntc", 7},
+    {"SbrkConst8", 4},
+    {"SetcMode", 17},
+    {"SetcM0M1Map", 7},
+    {"SetcObjmode", 5},
+    {"SetcXf", 5},
+    {"SfrAccShift", 6},
+    {"SfrAccT", 5},
+    {"SpmShift", 3},
+    {"SqraLoc16", 10},
+    {"SqrsLoc16", 10},
+    {"SubAccLoc16Objmode1", 12},
+    {"SubAccLoc16Objmode0", 12},
+    {"SubAccLoc16Shift1_15Objmode1", 17},
+    {"SubAccLoc16Shift1_15Objmode0", 17},
+    {"SubAccLoc16Shift16", 17},
+    {"SubAccLoc16ShiftT", 16},
+    {"SubAccConst16Shift", 11},
+    {"SubAxLoc16", 12},
+    {"SubLoc16Ax", 12},
+    {"SubbAccConst8", 6},
+    {"SubbSpConst7", 6},
+    {"SubbXarnConst7", 6},
+    {"SubblAccLoc32", 12},
+    {"SubcuAccLoc16", 12},
+    {"SubculAccLoc32", 12},
+    {"SublAccLoc32", 12},
+    {"SublLoc32Acc", 12},
+    {"SubrLoc16Ax", 12},
+    {"SubrlLoc32Acc", 12},
+    {"SubuAccLoc16", 12},
+    {"SubulAccLoc32", 12},
+    {"SubulPLoc32", 12},
+    {"TbitLoc16Bit", 13},
+    {"TbitLoc16T", 12},
+    {"TclrLoc16Bit", 13},
+    {"TestAcc", 3},
+    {"TrapVec", 4},
+    {"TsetLoc16Bit", 13},
+    {"UoutPaLoc16", 15},
+    {"XbAl", 4},
+    {"XbPmaArpn", 8},
+    {"XbPmaCond", 6},
+    {"XbanzPmaInd", 6},
+    {"XbanzPmaIndPostinc", 7},
+    {"XbanzPmaIndPostdec", 7},
+    {"XbanzPmaInd0Postinc", 8},
+    {"XbanzPmaInd0Postdec", 8},
+    {"XbanzPmaIndArpn", 8},
+    {"XbanzPmaIndPostincArpn", 9},
+    {"XbanzPmaIndPostdecArpn", 9},
+    {"XbanzPmaInd0PostincArpn", 10},
+    {"XbanzPmaInd0PostdecArpn", 10},
+    {"XcallAl", 4},
+    {"XcallPmaArpn", 8},
+    {"XcallPmaCond", 6},
+    {"XmacPLoc16Pma", 15},
+    {"XmacdPLoc16Pma", 15},
+    {"XorAccLoc16", 12},
+    {"XorAccConst16Shift0_15", 11},
+    {"XorAccConst16Shift16", 11},
+    {"XorAxLoc16", 12},
+    {"XorLoc16Ax", 12},
+    {"XorLoc16Const16", 13},
+    {"XorbAxConst8", 6},
+    {"XpreadLoc16Pma", 13},
+    {"XpreadLoc16Al", 13},
+    {"XpwriteAlLoc16", 13},
+    {"XretcCond", 3},
+    {"ZalrAccLoc16", 12},
+    {"Zapa", 1},
+    {"Absf32RahRbh", 0},
+    {"Addf32Rah16fhiRbh", 0},
+    {"Addf32RahRbhRch", 0},
+    {"Addf32RdhRehRfhMov32Mem32Rah", 0},
+    {"Addf32RdhRehRfhMov32RahMem32", 0},
+    {"Cmpf32RahRbh", 0},
+    {"Cmpf32Rah16fhi", 0},
+    {"Cmpf32Rah0", 0},
+    {"Einvf32RahRbh", 0},
+    {"Eisqrtf32RahRbh", 0},
+    {"F32toi16RahRbh", 0},
+    {"F32toi16rRahRbh", 0},
+    {"F32toi32RahRbh", 0},
+    {"F32toui16RahRbh", 0},
+    {"F32toui16rRahRbh", 0},
+    {"F32toui32RahRbh", 0},
+    {"Fracf32RahRbh", 0},
+    {"I16tof32RahRbh", 0},
+    {"I16tof32RahMem16", 0},
+    {"I32tof32RahMem32", 0},
+    {"I32tof32RahRbh", 0},
+    {"Macf32R3hR2hRdhRehRfh", 0},
+    {"Macf32R3hR2hRdhRehRfhMov32RahMem32", 0},
+    {"Macf32R7hR3hMem32Xar7Postinc", 0},
+    {"Macf32R7hR6hRdhRehRfh", 0},
+    {"Macf32R7hR6hRdhRehRfhMov32RahMem32", 0},
+    {"Maxf32RahRbh", 0},
+    {"Maxf32Rah16fhi", 0},
+    {"Maxf32RahRbhMov32RchRdh", 0},
+    {"Minf32RahRbh", 0},
+    {"Minf32Rah16fhi", 0},
+}};
+}  // namespace TIC28X
+
+#endif  // TIC28X_TEXT_TOKENS_H
@@ -0,0 +1,86 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+/**
+ * text_tokens - measures the most text tokens every instruction class
+ * renders (see SampleTextTokens) and writes them in the format of
+ * src/text_tokens.h, which sizes each line's token vector (see
+ * Registry::MAX_TOKENS). Rerun it whenever an instruction's Text changes;
+ * the MaxTokens test fails until then.
+ *
+ * Usage: tic28x_text_tokens path
+ */
+
+#include <cstdio>
+#include <string>
+
+#include "registry.h"
+#include "text.h"
+
+namespace {
+std::string Header() {
+  using TIC28X::Registry;
+  std::string out =
+      "// Copyright (c) 2025. Battelle Energy Alliance, LLC\n"
+      "// ALL RIGHTS RESERVED\n"
+      "\n"
+      "#ifndef TIC28X_TEXT_TOKENS_H\n"
+      "#define TIC28X_TEXT_TOKENS_H\n"
+      "\n"
+      "#include <array>\n"
+      "#include <cstdint>\n"
+      "\n"
+      "namespace TIC28X {\n"
+      "struct TextTokens {\n"
+      "  const char* name;  // full name of the instruction class\n"
+      "  uint8_t tokens;\n"
+      "};\n"
+      "\n"
+      "/**\n"
+      " * TEXT_TOKENS - the most text tokens each instruction class renders, "
+      "without\n"
+      " * the repeat prefix, as measured by SampleTextTokens. "
+      "Registry::MAX_TOKENS\n"
+      " * takes its counts from here, so each line's tokens are reserved "
+      "once and\n"
+      " * no more than needed.\n"
+      " *\n"
+      " * Generated by `tic28x_text_tokens src/text_tokens.h`; rerun it "
+      "whenever an\n"
+      " * instruction's Text changes.\n"
+      " */\n"
+      "inline constexpr std::array<TextTokens, ";
+  out += std::to_string(Registry::COUNT) + "> TEXT_TOKENS = {{\n";
+  for (uint16_t id = 0; id < Registry::COUNT; id++) {
+    out += "    {\"";
+    out += Registry::FULL_NAMES[id];
+    out += "\", " + std::to_string(TIC28X::SampleTextTokens(id)) + "},\n";
+  }
+  out +=
+      "}};\n"
+      "}  // namespace TIC28X\n"
+      "\n"
+      "#endif  // TIC28X_TEXT_TOKENS_H\n";
+  return out;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  if (argc != 2) {
+    std::fprintf(stderr, "usage: tic28x_text_tokens path\n");
+    return 2;
+  }
+  const std::string header = Header();
+  std::FILE* file = std::fopen(argv[1], "w");
+  if (!file) {
+    std::fprintf(stderr, "could not write %s\n", argv[1]);
+    return 1;
+  }
+  const bool written =
+      std::fwrite(header.data(), 1, header.size(), file) == header.size();
+  if (std::fclose(file) != 0 || !written) {
+    std::fprintf(stderr, "could not write %s\n", argv[1]);
+    return 1;
+  }
+  return 0;
+}
@@ -3,6 +3,8 @@
 
 #include "util.h"
 
+#include <charconv>
+
 #include "sizes.h"
 
 // Take in an array of bytes and create an integer opcode so we can extract data
@@ -22,4 +24,23 @@ uint64_t CreateLowerBitMask(unsigned int n) {
     return 0;
   }
   return (1u << n) - 1;
-}
\ No newline at end of file
+}
+
+// Formats a value as "0x..." into buf, without allocating. Negative values
+// keep their sign after the prefix ("0x-2"), like std::format("0x{:x}")
+template <class T>
+static std::string_view FormatHexImpl(const T value, HexBuffer& buf) {
+  buf[0] = '0';
+  buf[1] = 'x';
+  const auto end =
+      std::to_chars(buf.data() + 2, buf.data() + buf.size(), value, 16).ptr;
+  return {buf.data(), static_cast<size_t>(end - buf.data())};
+}
+
+std::string_view FormatHex(const uint64_t value, HexBuffer& buf) {
+  return FormatHexImpl(value, buf);
+}
+
+std::string_view FormatHex(const int64_t value, HexBuffer& buf) {
+  return FormatHexImpl(value, buf);
+}
@@ -3,12 +3,19 @@
 
 #ifndef TIC28X_UTIL_H_
 #define TIC28X_UTIL_H_
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 #include "binaryninjacore.h"
 
 uint32_t DataToOpcode(const uint8_t* data, size_t len);
 uint64_t CreateLowerBitMask(unsigned int n);
 
+// Fits "0x" and any 64-bit value, e.g. "0x-8000000000000000"
+using HexBuffer = std::array<char, 20>;
+std::string_view FormatHex(uint64_t value, HexBuffer& buf);
+std::string_view FormatHex(int64_t value, HexBuffer& buf);
+
 #endif
@@ -0,0 +1,114 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "views.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace TIC28X {
+/**
+ * Track - adds an architecture whose views are followed. Must be called
+ * before the architecture is registered.
+ *
+ * @param arch - plugin architecture
+ */
+void OpenViews::Track(TIC28XArchitecture* arch) {
+  if (ARCH_COUNT < ARCHS.size()) {
+    ARCHS[ARCH_COUNT++] = arch;
+  }
+}
+
+/**
+ * Add - starts following a view, if its default architecture is tracked.
+ *
+ * @param view - view whose analysis was finalized
+ */
+void OpenViews::Add(BN::BinaryView* view) {
+  const auto default_arch = view->GetDefaultArchitecture();
+  if (!default_arch) {
+    return;
+  }
+  const auto name = default_arch->GetName();
+  for (size_t i = 0; i < ARCH_COUNT; i++) {
+    if (ARCHS[i]->GetName() == name) {
+      std::unique_lock lock(MUTEX);
+      const auto handle = view->GetObject();
+      if (std::ranges::none_of(VIEWS, [handle](const View& open) {
+            return open.handle == handle;
+          })) {
+        VIEWS.push_back({handle, ARCHS[i]});
+      }
+      return;
+    }
+  }
+}
+
+/**
+ * DestructBinaryView - stops following a view, clearing its architecture's
+ * repeat addresses if no other view uses it.
+ *
+ * @param view - view being destroyed
+ */
+void OpenViews::DestructBinaryView(BN::BinaryView* view) {
+  std::unique_lock lock(MUTEX);
+  const auto open = std::ranges::find(VIEWS, view->GetObject(), &View::handle);
+  if (open == VIEWS.end()) {
+    return;
+  }
+  const auto arch = open->arch;
+  VIEWS.erase(open);
+  if (std::ranges::find(VIEWS, arch, &View::arch) == VIEWS.end()) {
+    arch->ClearRepeatAddrs();
+  }
+}
+
+/**
+ * Count - counts the open views of an architecture.
+ *
+ * @param arch - plugin architecture
+ * @return number of views followed
+ */
+size_t OpenViews::Count(const TIC28XArchitecture* arch) const {
+  std::shared_lock lock(MUTEX);
+  return std::ranges::count(VIEWS, arch, &View::arch);
+}
+
+/**
+ * Read - reads bytes from the open views of an architecture, for use as a
+ * ByteReader.
+ *
+ * The callbacks do not say which view they are for, so the bytes are only
+ * trusted if every open view of the architecture that maps them holds the
+ * same bytes. Views of other architectures are never read.
+ *
+ * @param arch - architecture asking for the bytes
+ * @param addr - address to read from
+ * @param data - buffer for at most MAX_READ bytes
+ * @param len - number of bytes to read
+ * @return true if at least one view holds the bytes and none disagree
+ */
+bool OpenViews::Read(const TIC28XArchitecture& arch, const uint64_t addr,
+                     uint8_t* data, const size_t len) const {
+  if (len > MAX_READ) {
+    return false;
+  }
+  std::array<uint8_t, MAX_READ> other;
+  bool found = false;
+  std::shared_lock lock(MUTEX);
+  for (const auto& view : VIEWS) {
+    if (view.arch != &arch) {
+      continue;
+    }
+    uint8_t* dest = found ? other.data() : data;
+    if (BNReadViewData(view.handle, dest, addr, len) != len) {
+      continue;
+    }
+    if (found && !std::equal(data, data + len, other.data())) {
+      return false;
+    }
+    found = true;
+  }
+  return found;
+}
+}  // namespace TIC28X
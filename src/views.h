@@ -0,0 +1,60 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TIC28X_VIEWS_H
+#define TIC28X_VIEWS_H
+
+#include <binaryninjaapi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+#include "architecture.h"
+
+namespace TIC28X {
+/**
+ * OpenViews - follows the open binary views whose default architecture is
+ * one of the plugin's.
+ *
+ * Binary Ninja's architecture callbacks do not say which view they are for,
+ * so per-view state such as the repeat addresses cannot be keyed by view.
+ * Instead each view is added when it is finalized, before its analysis
+ * starts, and when the last view of an architecture is destroyed that
+ * architecture's repeat addresses are cleared, so they do not pile up across
+ * views. Views of the same architecture open at the same time share its
+ * repeat addresses (see RepeatSet).
+ *
+ * The open views also back the architectures' ByteReader (see Read), which
+ * lets Text check that an RPT still comes before an instruction it recorded.
+ */
+class OpenViews final : public BN::ObjectDestructionNotification {
+ public:
+  static constexpr size_t MAX_ARCHITECTURES = 4;
+  static constexpr size_t MAX_READ = 8;  // bytes
+
+  void Track(TIC28XArchitecture* arch);
+  void Add(BN::BinaryView* view);
+  void DestructBinaryView(BN::BinaryView* view) override;
+  [[nodiscard]] size_t Count(const TIC28XArchitecture* arch) const;
+  bool Read(const TIC28XArchitecture& arch, uint64_t addr, uint8_t* data,
+            size_t len) const;
+
+ private:
+  struct View {
+    BNBinaryView* handle;
+    TIC28XArchitecture* arch;
+  };
+
+  // ARCHS are only written before the archs are registered, so reading them
+  // needs no lock; VIEWS change as views open and close
+  std::array<TIC28XArchitecture*, MAX_ARCHITECTURES> ARCHS{};
+  size_t ARCH_COUNT = 0;
+  mutable std::shared_mutex MUTEX;
+  std::vector<View> VIEWS;
+};
+}  // namespace TIC28X
+
+#endif  // TIC28X_VIEWS_H